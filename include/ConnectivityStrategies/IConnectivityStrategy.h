@@ -5,6 +5,7 @@
 #include <vector>
 #include <memory>
 #include "Core/INeuron.h"
+#include "Network/NetworkBuilder.h"
 
 namespace BioNeuralNetwork {
 
@@ -21,8 +22,16 @@ namespace BioNeuralNetwork {
          * @brief Método para conectar neuronas según la estrategia.
          * @param neurons Vector de neuronas a conectar.
          * @param manager Referencia al NetworkManager para crear sinapsis.
+         *
+         * Por defecto genera las aristas con buildConnections y las materializa
+         * de una vez con NetworkManager::addConnections.
          */
-        virtual void connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) = 0;
+        virtual void connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager);
+
+        /**
+         * @brief Añade al builder las aristas de la estrategia, por índice en [0, getNumNeurons()).
+         */
+        virtual void buildConnections(NetworkBuilder& builder) = 0;
     };
 
 }
@@ -21,7 +21,15 @@ namespace BioNeuralNetwork {
             : p_connection(connectionProbability), weight(defaultWeight), isExcitatory(excitatory),
               gen(rd()), dist(0.0, 1.0) {}
 
-        void connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) override;
+        /**
+         * @param seed Semilla del generador, para obtener una topología reproducible.
+         */
+        RandomConnectivityStrategy(double connectionProbability, double defaultWeight, bool excitatory,
+                                   unsigned int seed)
+            : p_connection(connectionProbability), weight(defaultWeight), isExcitatory(excitatory),
+              gen(seed), dist(0.0, 1.0) {}
+
+        void buildConnections(NetworkBuilder& builder) override;
 
     private:
         double p_connection;
@@ -21,7 +21,14 @@ public:
         : m_initialNodes(initialNodes), m_connectionsPerNewNode(connectionsPerNewNode),
           gen(rd()), dist(0.0, 1.0) {}
 
-    void connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) override;
+    /**
+     * @param seed Semilla del generador, para obtener una topología reproducible.
+     */
+    ScaleFreeConnectivityStrategy(int initialNodes, int connectionsPerNewNode, unsigned int seed)
+        : m_initialNodes(initialNodes), m_connectionsPerNewNode(connectionsPerNewNode),
+          gen(seed), dist(0.0, 1.0) {}
+
+    void buildConnections(NetworkBuilder& builder) override;
 
 private:
     int m_initialNodes;
@@ -18,7 +18,13 @@ namespace BioNeuralNetwork {
         SmallWorldConnectivityStrategy(double rewiringProbability, int connectionsPerNeuron)
             : p_rewire(rewiringProbability), k(connectionsPerNeuron), gen(rd()), dist(0.0, 1.0) {}
 
-        void connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) override;
+        /**
+         * @param seed Semilla del generador, para obtener una topología reproducible.
+         */
+        SmallWorldConnectivityStrategy(double rewiringProbability, int connectionsPerNeuron, unsigned int seed)
+            : p_rewire(rewiringProbability), k(connectionsPerNeuron), gen(seed), dist(0.0, 1.0) {}
+
+        void buildConnections(NetworkBuilder& builder) override;
 
     private:
         double p_rewire;               // Probabilidad de reconexión
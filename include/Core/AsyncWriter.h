@@ -0,0 +1,117 @@
+// include/Core/AsyncWriter.h
+#ifndef ASYNCWRITER_H
+#define ASYNCWRITER_H
+
+#include "Core/Logger.h"
+#include "Core/SpscRing.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    struct AsyncWriterConfig {
+        std::string spikesFile;            // CSV de spikes; vacío: se descartan
+        std::string weightChangesFile;     // CSV de cambios de peso; vacío: se descartan
+        std::string textLogFile;           // Log de texto con el formato de exportLogsToText; vacío: no se escribe
+        std::size_t recordsPerBuffer = 4096;
+        std::size_t maxPendingBuffers = 4; // Bloques sellados sin escribir antes de bloquear
+    };
+
+    /**
+     * @brief Escritura de registros en un hilo propio con bloques reciclados.
+     *
+     * El productor llena un bloque en memoria; al llenarse lo sella y lo entrega
+     * al hilo escritor por una cola sin bloqueos, que lo codifica en CSV mientras
+     * la simulación sigue. Los bloques escritos vuelven al productor por otra
+     * cola, de modo que no hay reservas en régimen estable. Hay
+     * maxPendingBuffers + 1 bloques: el productor solo se bloquea cuando el
+     * escritor acumula maxPendingBuffers bloques sin terminar.
+     *
+     * Los métodos de escritura admiten un único productor a la vez (Logger los
+     * serializa con su mutex).
+     *
+     * El log de texto lista primero los spikes y después los cambios de peso;
+     * estos se escriben durante la simulación en un fichero auxiliar
+     * (textLogFile + ".tmp") que close() añade al final y borra.
+     */
+    class AsyncWriter {
+    public:
+        static constexpr std::size_t kMaxPendingBuffers = 64;
+
+        explicit AsyncWriter(const AsyncWriterConfig& config);
+        ~AsyncWriter();
+
+        AsyncWriter(const AsyncWriter&) = delete;
+        AsyncWriter& operator=(const AsyncWriter&) = delete;
+
+        void writeSpike(const SpikeRecord& record);
+        void writeWeightChange(const WeightChangeRecord& record);
+
+        // Sella el bloque actual y espera a que todo lo entregado esté en disco;
+        // relanza el primer error de escritura
+        void flush();
+        void close();
+
+        std::uint64_t getSealedBuffers() const { return sealedBuffers; }
+        std::uint64_t getWrittenBuffers() const { return writtenBuffers.load(std::memory_order_acquire); }
+        std::uint64_t getStalls() const { return stalls; }   // Veces que el productor esperó al escritor
+
+    private:
+        struct RecordBuffer {
+            std::vector<SpikeRecord> spikes;
+            std::vector<WeightChangeRecord> weightChanges;
+
+            std::size_t size() const { return spikes.size() + weightChanges.size(); }
+            void clear() { spikes.clear(); weightChanges.clear(); }
+        };
+
+        void sealIfFull();
+        void seal();
+        template <typename Predicate> void waitProducer(Predicate ready);
+        void wakeProducer();
+        void wakeWriter();
+        void run();
+        void encode(const RecordBuffer& buffer);
+        void finishTextLog();
+
+        AsyncWriterConfig config;
+        std::ofstream spikesOut;
+        std::ofstream weightChangesOut;
+        std::ofstream textOut;
+        std::ofstream textWeightChangesOut;   // Sección de pesos del log de texto, hasta close()
+
+        std::vector<std::unique_ptr<RecordBuffer>> pool;
+        RecordBuffer* current = nullptr;
+        SpscRing<RecordBuffer*, 2 * kMaxPendingBuffers> sealedQueue;   // Productor -> escritor
+        SpscRing<RecordBuffer*, 2 * kMaxPendingBuffers> recycledQueue; // Escritor -> productor
+
+        std::uint64_t sealedBuffers = 0;
+        std::uint64_t stalls = 0;
+        std::atomic<std::uint64_t> writtenBuffers{0};
+
+        // Solo para dormir cuando no hay trabajo; el traspaso no toma el mutex
+        std::mutex parkMutex;
+        std::condition_variable producerWake;
+        std::condition_variable writerWake;
+        std::atomic<bool> producerWaiting{false};
+        std::atomic<bool> writerWaiting{false};
+        std::atomic<bool> stopping{false};
+
+        std::atomic<bool> failed{false};
+        std::exception_ptr error;
+        bool errorReported = false;
+
+        std::thread thread;
+    };
+
+}
+
+#endif // ASYNCWRITER_H
@@ -0,0 +1,28 @@
+// include/Core/AxonEvent.h
+#ifndef AXONEVENT_H
+#define AXONEVENT_H
+
+#include <cstdint>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Spike de una neurona pre que llega a todas sus sinapsis con un mismo retardo.
+     *
+     * Se expande a las sinapsis del grupo solo al entregarse, de modo que la cola
+     * crece con el número de spikes y no con el de sinapsis.
+     */
+    struct AxonEvent {
+        double time;                // Llegada a las neuronas post
+        double delay;               // Retardo del grupo de sinapsis
+        std::uint32_t neuronIndex;  // Neurona pre
+
+        AxonEvent() : time(0.0), delay(0.0), neuronIndex(0) {}
+
+        AxonEvent(double t, double d, std::uint32_t index)
+            : time(t), delay(d), neuronIndex(index) {}
+    };
+
+}
+
+#endif // AXONEVENT_H
@@ -0,0 +1,44 @@
+// include/Core/CounterRng.h
+#ifndef COUNTERRNG_H
+#define COUNTERRNG_H
+
+#include <cstdint>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Generador aleatorio basado en contador.
+     *
+     * Cada valor es una función pura de (clave, flujo, contador), de modo que
+     * la misma secuencia puede regenerarse en cualquier momento sin guardar
+     * estado: basta con conocer la semilla y el flujo (p. ej., la neurona pre).
+     */
+    class CounterRng {
+    public:
+        CounterRng(std::uint64_t seed, std::uint64_t stream)
+            : key(mix(seed ^ mix(stream + 0x9E3779B97F4A7C15ULL))) {}
+
+        std::uint64_t next() {
+            return mix(key + (++counter) * 0x9E3779B97F4A7C15ULL);
+        }
+
+        // Uniforme en [0, 1) con 53 bits
+        double uniform() {
+            return static_cast<double>(next() >> 11) * (1.0 / 9007199254740992.0);
+        }
+
+        // Finalizador de SplitMix64
+        static std::uint64_t mix(std::uint64_t z) {
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+            return z ^ (z >> 31);
+        }
+
+    private:
+        std::uint64_t key;
+        std::uint64_t counter = 0;
+    };
+
+}
+
+#endif // COUNTERRNG_H
@@ -1,7 +1,8 @@
 #ifndef EVENTMANAGER_H
 #define EVENTMANAGER_H
 
-#include <queue>
+#include <algorithm>
+#include <cstdint>
 #include <vector>
 #include <stdexcept>
 #include "Core/SpikeEvent.h"
@@ -9,45 +10,86 @@
 namespace BioNeuralNetwork {
 
     /**
-     * @brief Clase que gestiona la cola de eventos de spike ordenados por tiempo.
+     * @brief Clase que gestiona la cola de eventos ordenados por tiempo.
+     *
+     * Los eventos con el mismo tiempo se extraen en orden de inserción, de modo
+     * que la entrega es determinista independientemente del contenido de la cola.
+     * Event solo necesita un miembro time.
      */
-    class EventManager {
+    template <typename Event>
+    class BasicEventManager {
     public:
-        void pushEvent(const SpikeEvent &event) {
-            eventQueue.push(event);
+        void pushEvent(const Event &event) {
+            heap.push_back(Entry{event, nextSequence++});
+            std::push_heap(heap.begin(), heap.end(), CompareEvent());
+        }
+
+        /**
+         * @brief Inserta un lote de eventos conservando su orden relativo.
+         *
+         * Si el lote es grande respecto a la cola se reconstruye el montículo en
+         * tiempo lineal en lugar de insertar uno a uno.
+         */
+        void pushEvents(const std::vector<Event> &events) {
+            if (events.size() > heap.size()) {
+                heap.reserve(heap.size() + events.size());
+                for (const auto &event : events) {
+                    heap.push_back(Entry{event, nextSequence++});
+                }
+                std::make_heap(heap.begin(), heap.end(), CompareEvent());
+            } else {
+                for (const auto &event : events) {
+                    pushEvent(event);
+                }
+            }
         }
 
         bool empty() const {
-            return eventQueue.empty();
+            return heap.empty();
         }
 
+        std::size_t size() const {
+            return heap.size();
+        }
 
-        SpikeEvent popEvent() {
-            if (eventQueue.empty()) {
+        Event popEvent() {
+            if (heap.empty()) {
                 throw std::runtime_error("No hay eventos en la cola.");
             }
-            SpikeEvent e = eventQueue.top();
-            eventQueue.pop();
+            std::pop_heap(heap.begin(), heap.end(), CompareEvent());
+            Event e = heap.back().event;
+            heap.pop_back();
             return e;
         }
 
         double nextEventTime() const {
-            if (eventQueue.empty()) {
+            if (heap.empty()) {
                 return 1e20; // Indica que no hay eventos pendientes
             }
-            return eventQueue.top().time;
+            return heap.front().event.time;
         }
 
     private:
+        struct Entry {
+            Event event;
+            std::uint64_t sequence;
+        };
+
         struct CompareEvent {
-            bool operator()(const SpikeEvent &e1, const SpikeEvent &e2) {
-                return e1.time > e2.time;
+            bool operator()(const Entry &e1, const Entry &e2) const {
+                if (e1.event.time != e2.event.time) {
+                    return e1.event.time > e2.event.time;
+                }
+                return e1.sequence > e2.sequence;
             }
         };
 
-        std::priority_queue<SpikeEvent, std::vector<SpikeEvent>, CompareEvent> eventQueue;
+        std::vector<Entry> heap;
+        std::uint64_t nextSequence = 0;
     };
 
+    using EventManager = BasicEventManager<SpikeEvent>;
+
 }
 
 #endif // EVENTMANAGER_H
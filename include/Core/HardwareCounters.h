@@ -0,0 +1,124 @@
+// include/Core/HardwareCounters.h
+#ifndef HARDWARECOUNTERS_H
+#define HARDWARECOUNTERS_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "Core/Profiler.h"
+
+namespace BioNeuralNetwork {
+
+    enum class HardwareCounter {
+        Cycles,
+        Instructions,
+        LLCMisses,
+        BranchMisses,
+        Count
+    };
+
+    const char* toString(HardwareCounter counter);
+
+    constexpr std::size_t kNumHardwareCounters = static_cast<std::size_t>(HardwareCounter::Count);
+    using HardwareCounterValues = std::array<std::uint64_t, kNumHardwareCounters>;
+
+    /**
+     * @brief Grupo de contadores perf_event_open del hilo que lo abre.
+     *
+     * Los contadores que el núcleo no admite se omiten; si no se puede abrir
+     * ninguno el grupo queda no disponible y las lecturas devuelven false.
+     */
+    class PerfEventGroup {
+    public:
+        PerfEventGroup() = default;
+        ~PerfEventGroup();
+
+        PerfEventGroup(const PerfEventGroup&) = delete;
+        PerfEventGroup& operator=(const PerfEventGroup&) = delete;
+
+        bool open();
+        bool isOpen() const { return leaderFd >= 0; }
+        bool isSupported(HardwareCounter counter) const { return memberIndex[static_cast<std::size_t>(counter)] >= 0; }
+
+        // Valores acumulados desde la apertura (escalados si hubo multiplexación)
+        bool read(HardwareCounterValues& values) const;
+
+    private:
+        void close();
+
+        int leaderFd = -1;
+        std::vector<int> fds;
+        std::array<int, kNumHardwareCounters> memberIndex{{-1, -1, -1, -1}};
+    };
+
+    /**
+     * @brief Contadores de hardware acumulados por fase de simulación y por hilo.
+     *
+     * Cada ranura de hilo abre su propio grupo la primera vez que se usa desde
+     * ese hilo, de modo que se miden los hilos de simulación y no solo el principal.
+     */
+    class HardwareCounterProfiler {
+    public:
+        explicit HardwareCounterProfiler(std::size_t numThreadSlots);
+
+        // Intenta abrir los contadores en el hilo llamante (ranura 0)
+        bool probe();
+        bool isAvailable() const { return available; }
+
+        bool readSlot(std::size_t threadSlot, HardwareCounterValues& values);
+        void accumulate(std::size_t threadSlot, SimulationPhase phase,
+                        const HardwareCounterValues& begin, const HardwareCounterValues& end);
+
+        // Suma de todas las ranuras para una fase
+        HardwareCounterValues getPhaseTotals(SimulationPhase phase) const;
+        bool isSupported(HardwareCounter counter) const;
+
+        void printReport(std::ostream& out) const;
+
+    private:
+        struct alignas(64) Slot {
+            PerfEventGroup group;
+            bool tried = false;
+            std::array<HardwareCounterValues, static_cast<std::size_t>(SimulationPhase::Count)> totals{};
+        };
+
+        std::vector<Slot> slots;
+        bool available = false;
+    };
+
+    /**
+     * @brief Lee los contadores al entrar y salir del ámbito y acumula la diferencia.
+     *        Con profiler nulo no hace nada.
+     */
+    class HardwareCounterScope {
+    public:
+        HardwareCounterScope(HardwareCounterProfiler* profiler, std::size_t threadSlot, SimulationPhase phase)
+            : profiler(profiler), threadSlot(threadSlot), phase(phase)
+        {
+            if (profiler && !profiler->readSlot(threadSlot, begin)) {
+                this->profiler = nullptr;
+            }
+        }
+
+        ~HardwareCounterScope() {
+            HardwareCounterValues end;
+            if (profiler && profiler->readSlot(threadSlot, end)) {
+                profiler->accumulate(threadSlot, phase, begin, end);
+            }
+        }
+
+        HardwareCounterScope(const HardwareCounterScope&) = delete;
+        HardwareCounterScope& operator=(const HardwareCounterScope&) = delete;
+
+    private:
+        HardwareCounterProfiler* profiler;
+        std::size_t threadSlot;
+        SimulationPhase phase;
+        HardwareCounterValues begin{};
+    };
+
+}
+
+#endif // HARDWARECOUNTERS_H
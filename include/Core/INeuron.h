@@ -2,12 +2,16 @@
 #ifndef INEURON_H
 #define INEURON_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 #include "ISynapse.h"
+#include "SynapticKernel.h"
 
 namespace BioNeuralNetwork {
 
+    class PlacementArena;
+
     /**
      * @brief Interfaz para Neuronas
      */
@@ -24,11 +28,25 @@ namespace BioNeuralNetwork {
 
         virtual void injectCurrent(double current) = 0;
         virtual void resetAccumulatedCurrent() = 0;
+        // Multiplica la corriente acumulada (inyectada y sináptica instantánea) pendiente de integrar
+        virtual void scaleAccumulatedCurrent(double factor) = 0;
+
+        // Peso de un spike entrante según el modelo sináptico de la neurona
+        virtual void receiveSynapticInput(double weight, Receptor receptor) = 0;
+        virtual void setSynapticModel(const SynapticModel& model) = 0;
+        virtual const SynapticModel& getSynapticModel() const = 0;
 
         virtual void addIncomingSynapse(std::shared_ptr<ISynapse> synapse) = 0;
         virtual void addOutgoingSynapse(std::shared_ptr<ISynapse> synapse) = 0;
+        // Reserva capacidad para ese número de sinapsis adicionales en cada lista
+        virtual void reserveSynapses(std::size_t additionalOutgoing, std::size_t additionalIncoming) = 0;
+        // Quita de ambas listas las sinapsis que cumplen pruned, conservando el orden del resto
+        virtual void removeSynapsesIf(const std::function<bool(const ISynapse&)>& pruned) = 0;
 
         virtual int getID() const = 0;
+        // NetworkManager numera sus neuronas desde 1 en orden de creación
+        virtual void setID(int id) = 0;
+
         virtual const std::vector<std::shared_ptr<ISynapse>>& getOutgoingSynapses() const = 0;
         virtual const std::vector<std::shared_ptr<ISynapse>>& getIncomingSynapses() const = 0;
 
@@ -36,6 +54,27 @@ namespace BioNeuralNetwork {
         virtual double getRecovery() const = 0;
         virtual double getMembranePotential() const = 0;
         virtual double getResetPotential() const = 0;
+
+        /**
+         * @brief Número de pasos (hasta maxSteps) que la neurona puede avanzar con
+         *        skipQuiescent recibiendo solo la corriente constante current sin
+         *        llegar a disparar. 0 si no puede garantizarse o si tiene corriente
+         *        sináptica acumulada pendiente de integrar.
+         *
+         * tolerance es la derivada máxima (por ms) con la que un modelo sin forma
+         * cerrada se considera en reposo.
+         */
+        virtual long long quiescentHorizon(long long maxSteps, double dt, double current, double tolerance) const = 0;
+
+        // Avanza steps pasos sin spikes con corriente constante (forma cerrada o actualización en bloque)
+        virtual void skipQuiescent(long long steps, double dt, double current) = 0;
+
+        /**
+         * @brief Copia el estado y parámetros de la neurona (incluido su ID), sin sinapsis.
+         */
+        virtual std::shared_ptr<INeuron> clone() const = 0;
+        // Como clone(), con el objeto y su bloque de control en arena
+        virtual std::shared_ptr<INeuron> cloneInto(const std::shared_ptr<PlacementArena>& arena) const = 0;
     };
 
 }
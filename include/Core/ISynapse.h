@@ -6,6 +6,7 @@
 namespace BioNeuralNetwork {
 
     class INeuron;
+    class PlacementArena;
 
     /**
      * @brief Interfaz para las sinapsis
@@ -17,7 +18,35 @@ namespace BioNeuralNetwork {
         virtual void deliverSpikeFromPre(const std::shared_ptr<INeuron>& pre, double eventTime) = 0;
         virtual void deliverSpikeFromPost(const std::shared_ptr<INeuron>& post, double eventTime) = 0;
 
+        // Las dos mitades de deliverSpikeFromPre por separado: la corriente hacia
+        // la neurona post y el STDP, que lee los tiempos de disparo de ambas
+        virtual void transmitFromPre(const std::shared_ptr<INeuron>& pre) = 0;
+        virtual void applyPrePlasticity(const std::shared_ptr<INeuron>& pre, double eventTime) = 0;
+
         virtual double getDelay() const = 0;
+        virtual double getWeight() const = 0;
+        // Asigna el peso (limitado a [mínimo, máximo]) sin registrarlo en el Logger
+        virtual void setWeight(double weight) = 0;
+
+        /**
+         * @brief Instante desde el que el peso está sin interrupción en su mínimo, o
+         *        NaN si está por encima. Si está en el mínimo sin instante registrado
+         *        (p. ej. porque se creó así), se registra now.
+         */
+        virtual double weightFloorSince(double now) = 0;
+
+        virtual std::shared_ptr<INeuron> getPreNeuron() const = 0;
+        virtual std::shared_ptr<INeuron> getPostNeuron() const = 0;
+
+        /**
+         * @brief Copia la sinapsis (peso, retardo y parámetros STDP) entre otras neuronas.
+         */
+        virtual std::shared_ptr<ISynapse> cloneWithEndpoints(std::shared_ptr<INeuron> pre,
+                                                             std::shared_ptr<INeuron> post) const = 0;
+        // Como cloneWithEndpoints(), con el objeto y su bloque de control en arena
+        virtual std::shared_ptr<ISynapse> cloneWithEndpointsInto(std::shared_ptr<INeuron> pre,
+                                                                 std::shared_ptr<INeuron> post,
+                                                                 const std::shared_ptr<PlacementArena>& arena) const = 0;
     };
 
 }
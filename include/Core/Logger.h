@@ -5,12 +5,19 @@
 #include <vector>
 #include <string>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include "Core/Recorder.h"
 
 namespace BioNeuralNetwork {
 
+class AsyncWriter;
+struct AsyncWriterConfig;
+
 struct SpikeRecord {
     int neuronID;
     double time; // en ms
@@ -25,17 +32,30 @@ struct WeightChangeRecord {
 
 /**
  * @brief Clase Logger para registrar eventos de spikes y cambios de peso.
+ *
+ * Es el recorder en memoria (o en CSV con startStreaming) de NetworkManager.
  */
-class Logger {
+class Logger : public IRecorder {
 public:
+    /**
+     * @brief Logger global, el que instala el ejecutable. Las redes no tienen
+     *        Logger por defecto: cada NetworkManager recibe el suyo con setLogger.
+     */
     static Logger& getInstance() {
         static Logger instance;
         return instance;
     }
 
+    Logger();
+    ~Logger() override;
+
     void logSpike(int neuronID, double time);
     void logWeightChange(const std::string& synapseID, double time, double oldWeight, double newWeight);
 
+    void recordSpike(int neuronID, double time) override { logSpike(neuronID, time); }
+    // El ID de la sinapsis se registra como "preID_postID"
+    void recordWeightChange(const WeightChangeEvent& change) override;
+
     void exportSpikesToCSV(const std::string& filename);
     void exportWeightChangesToCSV(const std::string& filename);
 
@@ -47,10 +67,31 @@ public:
     // Método para habilitar/deshabilitar el logging en tiempo real
     void setRealTimeLogging(bool enable);
 
-private:
-    // Constructor privado para Singleton
-    Logger() : realTimeLogging(false) {}
+    // Con el registro de spikes desactivado logSpike no guarda nada (activo por defecto)
+    void setSpikeRecording(bool enable) { spikeRecording.store(enable, std::memory_order_relaxed); }
+    bool isSpikeRecording() const { return spikeRecording.load(std::memory_order_relaxed); }
+
+    /**
+     * @brief Escritura incremental en segundo plano: mientras está activa, los
+     *        registros se entregan a un AsyncWriter en lugar de guardarse en memoria,
+     *        y los export* solo incluyen lo registrado fuera de ella.
+     *
+     * Cada hilo acumula sus registros en un bloque propio y solo toma el mutex
+     * para entregar kStagingRecords de una vez al escritor; con el registro en
+     * tiempo real activo se vuelve a la entrega registro a registro. Los
+     * registros de hilos distintos pueden quedar intercalados por bloques.
+     * flushStreaming y stopStreaming recogen los bloques de todos los hilos,
+     * por lo que no deben llamarse mientras otro hilo registra (con
+     * NetworkManager, fuera de advance()).
+     */
+    void startStreaming(const AsyncWriterConfig& config);
+    void flushStreaming();   // Espera a que lo registrado esté en disco
+    void stopStreaming();    // Vacía y cierra los ficheros
+    bool isStreaming() const;
+
+    static constexpr std::size_t kStagingRecords = 256;
 
+private:
     // Evitar copia y asignación
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
@@ -59,11 +100,29 @@ private:
     std::vector<SpikeRecord> spikeRecords;
     std::vector<WeightChangeRecord> weightChangeRecords;
 
+    struct StagingBuffer;
+
+    // Bloque del hilo actual, o nullptr si los registros van por el mutex
+    StagingBuffer* stagingBuffer();
+    void handOff(StagingBuffer& staging);   // Requiere mtx; sin escritor no hace nada
+    void drainStaging();                    // Requiere mtx
+
+    // Escritor activo y registros que ya se le entregaron
+    std::unique_ptr<AsyncWriter> writer;
+    int streamedSpikes = 0;
+    int streamedWeightChanges = 0;
+
+    // Bloques por hilo de la sesión de streaming actual (0: sin bloques)
+    std::vector<std::unique_ptr<StagingBuffer>> stagingBuffers;
+    std::atomic<std::uint64_t> stagingSession{0};
+
     // Mutex para seguridad en hilos
     mutable std::mutex mtx;
 
     // Flag para logging en tiempo real
     bool realTimeLogging;
+
+    std::atomic<bool> spikeRecording{true};
 };
 
 } // namespace BioNeuralNetwork
@@ -18,6 +18,7 @@ namespace BioNeuralNetwork {
         ConnectivityParameters excitatoryConnectivity;
         ConnectivityParameters inhibitoryConnectivity;
         std::string connectivityStrategy; // Opciones: "Random", "SmallWorld", "ScaleFree"
+        long long seed = -1;              // Semilla de conectividad; -1 usa una semilla aleatoria
     };
 
 }
@@ -0,0 +1,103 @@
+// include/Core/PopulationStatistics.h
+#ifndef POPULATIONSTATISTICS_H
+#define POPULATIONSTATISTICS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    struct PopulationStatisticsConfig {
+        double binWidth = 10.0;          // Ancho del bin temporal (ms)
+        std::size_t historyBins = 100;   // Bins de tasa que se conservan por población
+        double isiBinWidth = 1.0;        // Ancho de bin del histograma de ISI (ms)
+        std::size_t isiBins = 200;       // El último bin acumula los ISI mayores
+    };
+
+    /**
+     * @brief Estadísticas de población actualizadas en línea a partir de los spikes.
+     *
+     * No guarda los spikes: la memoria es fija (proporcional al número de
+     * neuronas, poblaciones, bins de historia y bins de ISI) sea cual sea la
+     * duración de la simulación. Las medidas por bin (Fano, sincronía) usan
+     * solo los bins ya cerrados; advanceTo() cierra los que terminan antes
+     * del instante indicado. Los spikes deben llegar en orden temporal.
+     */
+    class PopulationStatistics {
+    public:
+        // populationOfNeuron vacío: todas las neuronas forman una sola población.
+        // Los bins empiezan a contarse en el que contiene startTime.
+        PopulationStatistics(std::size_t numNeurons,
+                             const std::vector<std::size_t>& populationOfNeuron,
+                             const PopulationStatisticsConfig& config = {},
+                             double startTime = 0.0);
+
+        // Añade una neurona al final, en population (que se crea si no existe)
+        void addNeuron(std::size_t population);
+
+        void recordSpike(std::size_t neuronIndex, double time);
+        void advanceTo(double time);
+
+        std::size_t getNumPopulations() const { return populations.size(); }
+        std::size_t getPopulationSize(std::size_t population) const;
+        std::size_t getPopulationOf(std::size_t neuronIndex) const;
+        long long getClosedBins() const { return closedBins; }
+        const PopulationStatisticsConfig& getConfig() const { return config; }
+
+        // Tasa media por neurona (Hz) sobre los bins cerrados
+        double getMeanRate(std::size_t population) const;
+
+        // Tasa por neurona (Hz) de los últimos bins cerrados, del más antiguo al más reciente
+        std::vector<double> getRateHistory(std::size_t population) const;
+
+        const std::vector<std::uint64_t>& getIsiHistogram(std::size_t population) const;
+        double getMeanIsi(std::size_t population) const;
+        double getIsiCV(std::size_t population) const;
+
+        // Varianza / media del recuento de spikes de la población por bin
+        double getFanoFactor(std::size_t population) const;
+
+        /**
+         * @brief Medida de sincronía chi² (Golomb): varianza de la actividad de la
+         *        población dividida por la suma de las varianzas individuales.
+         *        Vale ~1/N para actividad independiente y 1 para sincronía total.
+         */
+        double getSynchrony(std::size_t population) const;
+
+    private:
+        struct NeuronState {
+            double lastSpikeTime = -1.0;
+            long long bin = -1;         // Bin al que corresponde binCount
+            std::uint32_t binCount = 0;
+            std::uint64_t totalCount = 0;
+        };
+
+        struct PopulationState {
+            std::size_t size = 0;
+            std::uint64_t openCount = 0;         // Spikes del bin abierto
+            double openNeuronSquares = 0.0;      // Suma de n_i² del bin abierto
+            std::uint64_t closedSpikes = 0;
+            double sumCounts = 0.0;              // Sobre bins cerrados: suma de recuentos
+            double sumCountSquares = 0.0;        // ... de recuentos al cuadrado
+            double sumNeuronSquares = 0.0;       // ... de n_i² de cada neurona
+            std::vector<std::uint32_t> history;  // Anillo con los últimos recuentos
+            std::vector<std::uint64_t> isiHistogram;
+            std::uint64_t isiCount = 0;
+            double isiMean = 0.0;                // Welford
+            double isiM2 = 0.0;
+        };
+
+        void closeBinsBefore(long long bin);
+
+        PopulationStatisticsConfig config;
+        std::vector<std::size_t> populationOf;
+        std::vector<NeuronState> neurons;
+        std::vector<PopulationState> populations;
+        long long openBin = 0;
+        long long closedBins = 0;
+    };
+
+}
+
+#endif // POPULATIONSTATISTICS_H
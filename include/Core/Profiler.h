@@ -0,0 +1,113 @@
+// include/Core/Profiler.h
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Fases de un paso de simulación que se pueden medir por separado.
+     */
+    enum class SimulationPhase {
+        CurrentInjection,
+        Integration,
+        SpikeEmission,
+        EventDelivery,
+        Plasticity,
+        LoggerIO,
+        Count
+    };
+
+    const char* toString(SimulationPhase phase);
+
+    /**
+     * @brief Acumula el tiempo de cada fase por hilo y, opcionalmente, guarda una
+     *        traza Chrome/Perfetto de una ventana de pasos.
+     *
+     * Cada hilo escribe solo en su propia ranura (0 = hilo principal, 1..N =
+     * hilos de simulación), por lo que el registro no necesita sincronización.
+     */
+    class Profiler {
+    public:
+        using Clock = std::chrono::steady_clock;
+
+        Profiler();
+
+        // Reserva las ranuras por hilo y borra lo acumulado
+        void configure(std::size_t numThreadSlots);
+        void reset();
+
+        void record(std::size_t threadSlot, SimulationPhase phase, long long tick,
+                    Clock::time_point begin, Clock::time_point end);
+
+        double getPhaseSeconds(SimulationPhase phase) const;
+        double getPhaseSeconds(SimulationPhase phase, std::size_t threadSlot) const;
+        std::size_t getNumThreadSlots() const { return slots.size(); }
+
+        // Pasos [firstTick, lastTick] cuyas fases se guardarán en la traza
+        void setTraceWindow(long long firstTick, long long lastTick);
+        std::size_t getTraceEventCount() const;
+        void exportChromeTrace(const std::string& filename) const;
+
+    private:
+        struct TraceEvent {
+            SimulationPhase phase;
+            long long tick;
+            double startMicros;
+            double durationMicros;
+        };
+
+        struct alignas(64) ThreadSlot {
+            std::array<double, static_cast<std::size_t>(SimulationPhase::Count)> seconds{};
+            std::vector<TraceEvent> trace;
+        };
+
+        Clock::time_point epoch;
+        std::vector<ThreadSlot> slots;
+        long long traceFirstTick = 0;
+        long long traceLastTick = -1;
+    };
+
+    /**
+     * @brief Mide el ámbito en el que vive y lo registra en el Profiler al destruirse.
+     */
+    class ProfileScope {
+    public:
+        ProfileScope(Profiler& profiler, std::size_t threadSlot, SimulationPhase phase, long long tick)
+            : profiler(profiler), threadSlot(threadSlot), phase(phase), tick(tick),
+              begin(Profiler::Clock::now()) {}
+
+        ~ProfileScope() {
+            profiler.record(threadSlot, phase, tick, begin, Profiler::Clock::now());
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        Profiler& profiler;
+        std::size_t threadSlot;
+        SimulationPhase phase;
+        long long tick;
+        Profiler::Clock::time_point begin;
+    };
+
+}
+
+// La instrumentación del motor solo existe si se compila con BNN_ENABLE_PROFILING
+#define BNN_PROFILE_CONCAT_INNER(a, b) a##b
+#define BNN_PROFILE_CONCAT(a, b) BNN_PROFILE_CONCAT_INNER(a, b)
+#ifdef BNN_ENABLE_PROFILING
+#define BNN_PROFILE_SCOPE(profiler, slot, phase, tick) \
+    ::BioNeuralNetwork::ProfileScope BNN_PROFILE_CONCAT(bnnProfileScope, __LINE__)(profiler, slot, phase, tick)
+#else
+#define BNN_PROFILE_SCOPE(profiler, slot, phase, tick) do { } while (0)
+#endif
+
+#endif // PROFILER_H
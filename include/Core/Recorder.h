@@ -0,0 +1,145 @@
+// include/Core/Recorder.h
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    struct WeightChangeEvent {
+        int preID;
+        int postID;
+        double time;       // ms
+        double oldWeight;
+        double newWeight;
+    };
+
+    /**
+     * @brief Destino de los eventos de registro de una red.
+     *
+     * Los spikes los emite NetworkManager desde el hilo que llama a advance(),
+     * en orden (paso, índice de neurona). Los cambios de peso los emite cada
+     * sinapsis al aplicar STDP y pueden llegar desde varios hilos a la vez
+     * cuando la plasticidad se reparte en trozos.
+     */
+    class IRecorder {
+    public:
+        virtual ~IRecorder() = default;
+
+        virtual void recordSpike(int neuronID, double time) = 0;
+        virtual void recordWeightChange(const WeightChangeEvent& change) = 0;
+        virtual void flush() {}
+    };
+
+    /**
+     * @brief Reenvía cada evento a varios recorders, en el orden en que se añadieron.
+     */
+    class RecorderSet : public IRecorder {
+    public:
+        explicit RecorderSet(std::vector<IRecorder*> targets = {}) : targets(std::move(targets)) {}
+
+        void recordSpike(int neuronID, double time) override {
+            for (IRecorder* target : targets) {
+                target->recordSpike(neuronID, time);
+            }
+        }
+
+        void recordWeightChange(const WeightChangeEvent& change) override {
+            for (IRecorder* target : targets) {
+                target->recordWeightChange(change);
+            }
+        }
+
+        void flush() override {
+            for (IRecorder* target : targets) {
+                target->flush();
+            }
+        }
+
+    private:
+        std::vector<IRecorder*> targets;
+    };
+
+    /**
+     * @brief Solo cuenta los eventos, sin guardarlos.
+     */
+    class CountingRecorder : public IRecorder {
+    public:
+        void recordSpike(int, double) override { spikes.fetch_add(1, std::memory_order_relaxed); }
+        void recordWeightChange(const WeightChangeEvent&) override {
+            weightChanges.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::uint64_t getSpikeCount() const { return spikes.load(std::memory_order_relaxed); }
+        std::uint64_t getWeightChangeCount() const { return weightChanges.load(std::memory_order_relaxed); }
+
+    private:
+        std::atomic<std::uint64_t> spikes{0};
+        std::atomic<std::uint64_t> weightChanges{0};
+    };
+
+    /**
+     * @brief Llama a funciones del usuario; cualquiera de las dos puede estar vacía.
+     *
+     * onWeightChange debe admitir llamadas concurrentes si la red usa varios hilos.
+     */
+    class CallbackRecorder : public IRecorder {
+    public:
+        CallbackRecorder(std::function<void(int, double)> onSpike,
+                         std::function<void(const WeightChangeEvent&)> onWeightChange = {})
+            : onSpike(std::move(onSpike)), onWeightChange(std::move(onWeightChange)) {}
+
+        void recordSpike(int neuronID, double time) override {
+            if (onSpike) {
+                onSpike(neuronID, time);
+            }
+        }
+
+        void recordWeightChange(const WeightChangeEvent& change) override {
+            if (onWeightChange) {
+                onWeightChange(change);
+            }
+        }
+
+    private:
+        std::function<void(int, double)> onSpike;
+        std::function<void(const WeightChangeEvent&)> onWeightChange;
+    };
+
+    /**
+     * @brief Escribe los eventos en un fichero binario de registros de tamaño fijo.
+     *
+     * Cada registro empieza por un byte de tipo ('S' spike, 'W' cambio de peso)
+     * seguido de sus campos en la representación nativa: int32 ID y double
+     * tiempo para un spike; int32 pre, int32 post y tres double (tiempo, peso
+     * anterior y nuevo) para un cambio de peso. readBinaryRecords los decodifica.
+     */
+    class BinaryFileRecorder : public IRecorder {
+    public:
+        explicit BinaryFileRecorder(const std::string& filename);
+
+        void recordSpike(int neuronID, double time) override;
+        void recordWeightChange(const WeightChangeEvent& change) override;
+        void flush() override;
+
+    private:
+        std::mutex mtx;
+        std::ofstream out;
+    };
+
+    struct BinaryRecords {
+        std::vector<std::pair<int, double>> spikes;
+        std::vector<WeightChangeEvent> weightChanges;
+    };
+
+    BinaryRecords readBinaryRecords(const std::string& filename);
+
+}
+
+#endif // RECORDER_H
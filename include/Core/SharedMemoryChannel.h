@@ -0,0 +1,70 @@
+// include/Core/SharedMemoryChannel.h
+#ifndef SHAREDMEMORYCHANNEL_H
+#define SHAREDMEMORYCHANNEL_H
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include "Core/SpscRing.h"
+
+namespace BioNeuralNetwork {
+
+    // Estímulo enviado por el controlador externo
+    struct StimulusMessage {
+        std::int64_t tick;        // Paso en el que debe aplicarse
+        std::int32_t neuronIndex;
+        float current;
+    };
+
+    // Spike publicado por el simulador
+    struct SpikeMessage {
+        std::int64_t tick;
+        std::int32_t neuronIndex;
+        std::int32_t reserved;
+    };
+
+    /**
+     * @brief Canal de memoria compartida POSIX para experimentos en lazo cerrado.
+     *
+     * Contiene dos colas SPSC: estímulos (controlador -> simulador) y spikes
+     * (simulador -> controlador), además del último paso completado.
+     */
+    class SharedMemoryChannel {
+    public:
+        static constexpr std::size_t kRingCapacity = 4096;
+
+        using StimulusRing = SpscRing<StimulusMessage, kRingCapacity>;
+        using SpikeRing = SpscRing<SpikeMessage, kRingCapacity>;
+
+        // Crea el segmento (lado del simulador); se elimina al destruir el canal
+        static SharedMemoryChannel create(const std::string& name);
+        // Abre un segmento existente (lado del controlador)
+        static SharedMemoryChannel open(const std::string& name);
+
+        SharedMemoryChannel(SharedMemoryChannel&& other) noexcept;
+        SharedMemoryChannel& operator=(SharedMemoryChannel&& other) noexcept;
+        SharedMemoryChannel(const SharedMemoryChannel&) = delete;
+        SharedMemoryChannel& operator=(const SharedMemoryChannel&) = delete;
+        ~SharedMemoryChannel();
+
+        StimulusRing& stimulus();
+        SpikeRing& spikes();
+
+        // Último paso completado por el simulador (-1 si ninguno)
+        void publishCompletedTick(std::int64_t tick);
+        std::int64_t completedTick() const;
+
+    private:
+        struct Layout;
+
+        SharedMemoryChannel(const std::string& name, Layout* layout, bool owner);
+        void release();
+
+        std::string name;
+        Layout* layout = nullptr;
+        bool owner = false;
+    };
+
+}
+
+#endif // SHAREDMEMORYCHANNEL_H
@@ -16,6 +16,8 @@ namespace BioNeuralNetwork {
         std::weak_ptr<INeuron> preNeuron;  // Neurona pre-sináptica
         std::weak_ptr<ISynapse> synapse;   // Sinapsis a través de la cual se transmite el spike
 
+        SpikeEvent() : time(0.0) {}
+
         SpikeEvent(double t,
                    const std::shared_ptr<INeuron>& pre,
                    const std::shared_ptr<ISynapse>& s)
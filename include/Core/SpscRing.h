@@ -0,0 +1,70 @@
+// include/Core/SpscRing.h
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Cola circular sin bloqueos para un único productor y un único consumidor.
+     *
+     * Su disposición en memoria es fija y no contiene punteros, por lo que puede
+     * ubicarse en un segmento de memoria compartida entre procesos.
+     */
+    template <typename T, std::size_t Capacity>
+    class SpscRing {
+        static_assert((Capacity & (Capacity - 1)) == 0, "La capacidad debe ser potencia de dos.");
+        static_assert(std::is_trivially_copyable<T>::value, "T debe ser trivialmente copiable.");
+        static_assert(std::atomic<std::uint64_t>::is_always_lock_free,
+                      "Se requieren atómicos de 64 bits sin bloqueo.");
+
+    public:
+        SpscRing() = default;
+        SpscRing(const SpscRing&) = delete;
+        SpscRing& operator=(const SpscRing&) = delete;
+
+        // Solo productor: devuelve false si la cola está llena
+        bool tryPush(const T &item) {
+            const std::uint64_t t = tail.load(std::memory_order_relaxed);
+            if (t - head.load(std::memory_order_acquire) >= Capacity) {
+                return false;
+            }
+            slots[t & (Capacity - 1)] = item;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        // Solo consumidor: devuelve false si la cola está vacía
+        bool tryPop(T &item) {
+            const std::uint64_t h = head.load(std::memory_order_relaxed);
+            if (h == tail.load(std::memory_order_acquire)) {
+                return false;
+            }
+            item = slots[h & (Capacity - 1)];
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        std::size_t size() const {
+            return static_cast<std::size_t>(tail.load(std::memory_order_acquire) -
+                                            head.load(std::memory_order_acquire));
+        }
+
+        bool empty() const { return size() == 0; }
+
+        static constexpr std::size_t capacity() { return Capacity; }
+
+    private:
+        // Índices separados en líneas de caché distintas para evitar false sharing
+        alignas(64) std::atomic<std::uint64_t> head{0}; // Escrito por el consumidor
+        alignas(64) std::atomic<std::uint64_t> tail{0}; // Escrito por el productor
+        alignas(64) T slots[Capacity];
+    };
+
+}
+
+#endif // SPSCRING_H
@@ -0,0 +1,112 @@
+// include/Core/StateProbe.h
+#ifndef STATEPROBE_H
+#define STATEPROBE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    class INeuron;
+    class ISynapse;
+
+    enum class ProbeVariable : std::uint32_t {
+        MembranePotential,   // V de cada neurona
+        Recovery,            // u de cada neurona (0 en LIF)
+        SynapticWeight       // Peso de cada sinapsis
+    };
+
+    struct ProbeConfig {
+        ProbeVariable variable = ProbeVariable::MembranePotential;
+        std::vector<std::size_t> neurons;                              // Índices de getNeurons()
+        std::vector<std::pair<std::size_t, std::size_t>> synapses;     // (pre, post) para SynapticWeight
+        long long samplingInterval = 1;   // Pasos entre muestras
+        std::size_t bufferSamples = 1024; // Muestras por bloque en memoria
+        std::string filename;             // Fichero binario; vacío: solo el bloque en memoria
+    };
+
+    /**
+     * @brief Contenido de un fichero de sonda: una fila de valores por muestra.
+     */
+    struct ProbeRecording {
+        ProbeVariable variable = ProbeVariable::MembranePotential;
+        double timeStep = 0.0;
+        long long samplingInterval = 1;
+        std::vector<std::uint64_t> targets;   // Neuronas, o pares pre, post consecutivos
+        std::vector<long long> ticks;
+        std::vector<double> values;           // ticks.size() * número de objetivos
+
+        std::size_t getNumTargets() const;
+        double at(std::size_t sample, std::size_t target) const;
+    };
+
+    /**
+     * @brief Registro de una variable de estado de un subconjunto de neuronas o sinapsis.
+     *
+     * Escribe cada muestra en un bloque contiguo reservado de antemano (sin
+     * reservas ni bloqueos por muestra, desde el hilo que avanza la red) y lo
+     * vuelca entero al fichero cuando se llena. Sin fichero, el bloque se
+     * conserva en memoria y las muestras que no caben se descartan.
+     *
+     * Formato: cabecera ("BNNPROBE", versión, variable, objetivos, dt, intervalo,
+     * índices) seguida de bloques (n, n pasos, n * objetivos valores).
+     */
+    class StateProbe {
+    public:
+        StateProbe(const ProbeConfig& config, double timeStep, long long startTick);
+        ~StateProbe();
+
+        StateProbe(const StateProbe&) = delete;
+        StateProbe& operator=(const StateProbe&) = delete;
+
+        const ProbeConfig& getConfig() const { return config; }
+        std::size_t getNumTargets() const { return numTargets; }
+
+        // Objetivos resueltos por NetworkManager; una sinapsis nula se registra como NaN
+        void bindNeurons(std::vector<const INeuron*> targets);
+        void bindSynapses(std::vector<const ISynapse*> targets);
+
+        // Traduce los índices de la configuración tras reordenar la red. La cabecera
+        // del fichero conserva los índices con los que se creó la sonda
+        void remapTargets(const std::vector<std::size_t>& newIndexOf);
+
+        long long getNextSampleTick() const { return nextTick; }
+        void sample(long long tick);
+        void flush();
+
+        std::uint64_t getSampleCount() const { return totalSamples; }
+        std::uint64_t getDroppedSamples() const { return droppedSamples; }
+
+        // Bloque aún no volcado
+        std::size_t getBufferedSamples() const { return buffered; }
+        const long long* getBufferedTicks() const { return ticks.data(); }
+        const double* getBufferedValues() const { return values.data(); }
+
+        static ProbeRecording readFile(const std::string& filename);
+
+    private:
+        void writeHeader(double timeStep);
+
+        ProbeConfig config;
+        std::size_t numTargets;
+        long long nextTick;
+
+        std::vector<const INeuron*> boundNeurons;
+        std::vector<const ISynapse*> boundSynapses;
+
+        std::vector<long long> ticks;    // bufferSamples
+        std::vector<double> values;      // bufferSamples * numTargets
+        std::size_t buffered = 0;
+        std::uint64_t totalSamples = 0;
+        std::uint64_t droppedSamples = 0;
+
+        std::FILE* file = nullptr;
+    };
+
+}
+
+#endif // STATEPROBE_H
@@ -0,0 +1,95 @@
+// include/Core/SynapticKernel.h
+#ifndef SYNAPTICKERNEL_H
+#define SYNAPTICKERNEL_H
+
+#include <cmath>
+
+namespace BioNeuralNetwork {
+
+    enum class SynapseDynamics {
+        Instantaneous,          // La corriente actúa solo en el paso siguiente al spike
+        ExponentialCurrent,     // Corriente que decae con tau por receptor
+        ExponentialConductance  // Conductancia que decae con tau; I = g (E_rev - V)
+    };
+
+    enum class Receptor {
+        Excitatory,
+        Inhibitory
+    };
+
+    struct SynapticModel {
+        SynapseDynamics dynamics = SynapseDynamics::Instantaneous;
+        double tauExcitatory = 5.0;          // ms
+        double tauInhibitory = 10.0;         // ms
+        double reversalExcitatory = 0.0;     // mV, solo conductancia
+        double reversalInhibitory = -80.0;   // mV, solo conductancia
+    };
+
+    /**
+     * @brief Estado sináptico agregado de una neurona: una variable por receptor.
+     *
+     * Los spikes entrantes suman su peso a la variable de su receptor, que decae
+     * exponencialmente una vez por paso, de modo que el coste de la dinámica
+     * sináptica es O(neuronas) por paso sea cual sea el número de sinapsis. En modo
+     * instantáneo el estado no se usa y el peso va directamente a la corriente
+     * acumulada de la neurona.
+     */
+    class SynapticKernel {
+    public:
+        const SynapticModel& getModel() const { return model; }
+
+        void setModel(const SynapticModel& newModel) {
+            model = newModel;
+            cachedDt = -1.0;
+        }
+
+        bool isInstantaneous() const { return model.dynamics == SynapseDynamics::Instantaneous; }
+
+        // Sin estado pendiente: permite saltar pasos inactivos
+        bool isIdle() const { return excitatory == 0.0 && inhibitory == 0.0; }
+
+        void receive(double weight, Receptor receptor) {
+            (receptor == Receptor::Excitatory ? excitatory : inhibitory) += weight;
+        }
+
+        // Corriente sináptica con el potencial de membrana V
+        double current(double V) const {
+            if (model.dynamics == SynapseDynamics::ExponentialConductance) {
+                return excitatory * (model.reversalExcitatory - V) + inhibitory * (model.reversalInhibitory - V);
+            }
+            return excitatory - inhibitory;
+        }
+
+        // Decaimiento exacto de un paso; por debajo de kFlushThreshold el estado se anula
+        void decay(double dt) {
+            if (isIdle()) {
+                return;
+            }
+            if (dt != cachedDt) {
+                cachedDt = dt;
+                decayExcitatory = std::exp(-dt / model.tauExcitatory);
+                decayInhibitory = std::exp(-dt / model.tauInhibitory);
+            }
+            excitatory *= decayExcitatory;
+            inhibitory *= decayInhibitory;
+            if (std::abs(excitatory) < kFlushThreshold) excitatory = 0.0;
+            if (std::abs(inhibitory) < kFlushThreshold) inhibitory = 0.0;
+        }
+
+        double getExcitatory() const { return excitatory; }
+        double getInhibitory() const { return inhibitory; }
+
+    private:
+        static constexpr double kFlushThreshold = 1e-12;
+
+        SynapticModel model;
+        double excitatory = 0.0;
+        double inhibitory = 0.0;
+        double cachedDt = -1.0;
+        double decayExcitatory = 1.0;
+        double decayInhibitory = 1.0;
+    };
+
+}
+
+#endif // SYNAPTICKERNEL_H
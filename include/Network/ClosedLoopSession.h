@@ -0,0 +1,41 @@
+// include/Network/ClosedLoopSession.h
+#ifndef CLOSEDLOOPSESSION_H
+#define CLOSEDLOOPSESSION_H
+
+#include <cstddef>
+#include <vector>
+#include "Core/SharedMemoryChannel.h"
+
+namespace BioNeuralNetwork {
+
+    class NetworkManager;
+
+    /**
+     * @brief Conecta un NetworkManager con un controlador externo a través de
+     *        un SharedMemoryChannel, avanzando la simulación paso a paso.
+     */
+    class ClosedLoopSession {
+    public:
+        ClosedLoopSession(NetworkManager& manager, SharedMemoryChannel& channel);
+
+        /**
+         * @brief Ejecuta pasos hasta untilTick. En cada paso aplica los estímulos
+         *        recibidos, avanza un tick y publica los spikes emitidos.
+         */
+        void run(long long untilTick);
+
+        // Spikes descartados porque la cola de salida estaba llena
+        std::size_t getDroppedSpikes() const { return droppedSpikes; }
+
+    private:
+        void drainStimulus(long long tick);
+
+        NetworkManager& manager;
+        SharedMemoryChannel& channel;
+        std::vector<StimulusMessage> pending; // Estímulos programados para pasos futuros
+        std::size_t droppedSpikes = 0;
+    };
+
+}
+
+#endif // CLOSEDLOOPSESSION_H
@@ -0,0 +1,98 @@
+// include/Network/EnsembleSimulator.h
+#ifndef ENSEMBLESIMULATOR_H
+#define ENSEMBLESIMULATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#include "Network/NetworkManager.h"
+#include "Neurons/IzhikevichNeuron.h"
+
+namespace BioNeuralNetwork {
+
+    struct EnsembleConfig {
+        std::size_t numInstances = 8;
+        double timeStep = 1.0;
+        double backgroundCurrent = 10.0;
+        double noiseStd = 0.0;               // Desviación del ruido gaussiano de estímulo
+        std::uint64_t baseSeed = 1;          // Semilla de la instancia k: baseSeed + k
+        std::vector<std::uint64_t> seeds;    // Si no está vacío, una semilla por instancia
+        bool recordSpikes = true;
+    };
+
+    /**
+     * @brief Simula K instancias independientes de la misma red a la vez.
+     *
+     * La conectividad se copia una sola vez a una estructura CSR de solo lectura
+     * compartida por todas las instancias. El estado de las neuronas se guarda con
+     * el índice de instancia como dimensión interior (neurona * K + instancia), de
+     * modo que la integración de una neurona y la entrega de cada sinapsis recorren
+     * las K instancias en un bucle contiguo y sin saltos que el compilador vectoriza.
+     *
+     * Los pesos son fijos (sin STDP) porque se comparten entre instancias, y solo se
+     * admiten neuronas de Izhikevich. Cada instancia tiene su propia semilla de
+     * estímulo, su corriente externa y su registro de spikes.
+     */
+    class EnsembleSimulator {
+    public:
+        EnsembleSimulator(const NetworkManager& network, const EnsembleConfig& config);
+
+        // Avanza todas las instancias hasta el paso untilTick (exclusivo)
+        void advance(long long untilTick);
+
+        // Corriente externa para una instancia en el siguiente paso
+        void injectExternalCurrent(std::size_t instance, std::size_t neuronIndex, double current);
+
+        std::size_t getNumInstances() const { return numInstances; }
+        std::size_t getNumNeurons() const { return numNeurons; }
+        std::size_t getNumSynapses() const { return targets.size(); }
+        long long getCurrentTick() const { return currentTick; }
+
+        double getPotential(std::size_t instance, std::size_t neuronIndex) const;
+        std::uint64_t getSpikeCount(std::size_t instance) const;
+        const std::vector<EmittedSpike>& getSpikes(std::size_t instance) const;
+
+        void exportSpikesToCSV(std::size_t instance, const std::string& filename) const;
+
+    private:
+        std::size_t stateIndex(std::size_t instance, std::size_t neuronIndex) const;
+        void gatherInput();
+        void integrate();
+        void recordAndDeliver();
+
+        EnsembleConfig config;
+        std::size_t numInstances;
+        std::size_t numNeurons;
+        long long currentTick = 0;
+
+        // Parámetros por neurona (compartidos)
+        std::vector<IzhikevichParameters> parameters;
+
+        // Conectividad CSR compartida: sinapsis salientes de n en [offsets[n], offsets[n+1])
+        std::vector<std::size_t> offsets;
+        std::vector<std::uint32_t> targets;
+        std::vector<double> weights;          // Con signo: negativo para inhibitorias
+        std::vector<std::uint32_t> delaySteps;
+
+        // Estado por (neurona, instancia), instancia en la dimensión interior
+        std::vector<double> V;
+        std::vector<double> u;
+        std::vector<double> timeSinceLastSpike;
+        std::vector<double> externalCurrents;
+        std::vector<double> input;            // Corriente total del paso en curso
+        std::vector<double> fired;            // 1.0 si disparó en este paso
+
+        // Corriente sináptica pendiente por ranura de retardo
+        std::size_t numSlots;
+        std::vector<double> delayRing;
+
+        std::vector<std::mt19937_64> generators;
+        std::vector<std::uint64_t> spikeCounts;
+        std::vector<std::vector<EmittedSpike>> spikes;
+    };
+
+}
+
+#endif // ENSEMBLESIMULATOR_H
@@ -0,0 +1,45 @@
+// include/Network/ISpikeTransport.h
+#ifndef ISPIKETRANSPORT_H
+#define ISPIKETRANSPORT_H
+
+#include <cstdint>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Spike intercambiado entre procesos (índice global de neurona y paso).
+     */
+    struct RemoteSpike {
+        std::int64_t tick;
+        std::uint32_t neuronIndex;
+        std::uint32_t reserved;
+    };
+
+    /**
+     * @brief Interfaz de transporte para la simulación distribuida.
+     *
+     * Todas las llamadas son colectivas: cada rank debe invocarlas en el mismo orden.
+     */
+    class ISpikeTransport {
+    public:
+        virtual ~ISpikeTransport() = default;
+
+        virtual int getRank() const = 0;
+        virtual int getSize() const = 0;
+
+        /**
+         * @brief Envía los spikes locales a todos los ranks y recibe los del resto.
+         * @param outgoing Spikes emitidos por las neuronas de este rank.
+         * @param incoming Se rellena con los spikes de los demás ranks.
+         */
+        virtual void exchange(const std::vector<RemoteSpike>& outgoing,
+                              std::vector<RemoteSpike>& incoming) = 0;
+
+        // Mínimo global de un valor entre todos los ranks
+        virtual double minAcrossRanks(double value) = 0;
+    };
+
+}
+
+#endif // ISPIKETRANSPORT_H
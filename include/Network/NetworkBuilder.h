@@ -0,0 +1,118 @@
+// include/Network/NetworkBuilder.h
+#ifndef NETWORKBUILDER_H
+#define NETWORKBUILDER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Network/SynapseIndex.h"
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Lista de aristas por índices que se materializa de una sola vez.
+     *
+     * Las estrategias de conectividad añaden aristas (pre, post) con peso, retardo
+     * y tipo sin crear objetos; NetworkManager::addConnections cuenta los grados,
+     * reserva las listas de cada neurona y crea las sinapsis en una pasada
+     * paralela. El orden de inserción se conserva: el resultado es el mismo que
+     * llamar a connectExcitatory/connectInhibitory arista a arista.
+     * Las variantes IfAbsent descartan los pares ya añadidos al builder.
+     */
+    class NetworkBuilder {
+    public:
+        explicit NetworkBuilder(std::size_t numNeurons) : numNeurons(numNeurons) {}
+
+        std::size_t getNumNeurons() const { return numNeurons; }
+        std::size_t size() const { return pre.size(); }
+        bool empty() const { return pre.empty(); }
+
+        void reserve(std::size_t edges) {
+            pre.reserve(edges);
+            post.reserve(edges);
+            weight.reserve(edges);
+            delay.reserve(edges);
+            excitatory.reserve(edges);
+        }
+
+        void addEdge(std::uint32_t preIndex, std::uint32_t postIndex, double edgeWeight, double edgeDelay,
+                     bool isExcitatory)
+        {
+            pre.push_back(preIndex);
+            post.push_back(postIndex);
+            weight.push_back(edgeWeight);
+            delay.push_back(edgeDelay);
+            excitatory.push_back(isExcitatory ? 1 : 0);
+        }
+
+        void addExcitatory(std::uint32_t preIndex, std::uint32_t postIndex, double edgeWeight = 1.0,
+                           double edgeDelay = 1.0)
+        {
+            addEdge(preIndex, postIndex, edgeWeight, edgeDelay, true);
+        }
+
+        void addInhibitory(std::uint32_t preIndex, std::uint32_t postIndex, double edgeWeight = 1.0,
+                           double edgeDelay = 1.0)
+        {
+            addEdge(preIndex, postIndex, edgeWeight, edgeDelay, false);
+        }
+
+        // Añade la arista solo si el par (pre, post) no está ya en el builder
+        bool addEdgeIfAbsent(std::uint32_t preIndex, std::uint32_t postIndex, double edgeWeight, double edgeDelay,
+                             bool isExcitatory)
+        {
+            // El índice se crea con el primer uso e incorpora las aristas añadidas sin comprobar
+            for (; indexedEdges < pre.size(); ++indexedEdges) {
+                edgeIndex.insert(pre[indexedEdges], post[indexedEdges], indexedEdges);
+            }
+            if (!edgeIndex.insert(preIndex, postIndex, pre.size())) {
+                return false;
+            }
+            addEdge(preIndex, postIndex, edgeWeight, edgeDelay, isExcitatory);
+            ++indexedEdges;
+            return true;
+        }
+
+        bool addExcitatoryIfAbsent(std::uint32_t preIndex, std::uint32_t postIndex, double edgeWeight = 1.0,
+                                   double edgeDelay = 1.0)
+        {
+            return addEdgeIfAbsent(preIndex, postIndex, edgeWeight, edgeDelay, true);
+        }
+
+        bool addInhibitoryIfAbsent(std::uint32_t preIndex, std::uint32_t postIndex, double edgeWeight = 1.0,
+                                   double edgeDelay = 1.0)
+        {
+            return addEdgeIfAbsent(preIndex, postIndex, edgeWeight, edgeDelay, false);
+        }
+
+        void clear() {
+            edgeIndex.clear();
+            indexedEdges = 0;
+            pre.clear();
+            post.clear();
+            weight.clear();
+            delay.clear();
+            excitatory.clear();
+        }
+
+        const std::vector<std::uint32_t>& getPre() const { return pre; }
+        const std::vector<std::uint32_t>& getPost() const { return post; }
+        const std::vector<double>& getWeights() const { return weight; }
+        const std::vector<double>& getDelays() const { return delay; }
+        const std::vector<std::uint8_t>& getExcitatory() const { return excitatory; }
+
+    private:
+        std::size_t numNeurons;
+        std::vector<std::uint32_t> pre;
+        std::vector<std::uint32_t> post;
+        std::vector<double> weight;
+        std::vector<double> delay;
+        std::vector<std::uint8_t> excitatory;
+
+        PairIndex<std::size_t> edgeIndex;   // Par -> arista, solo para las variantes IfAbsent
+        std::size_t indexedEdges = 0;
+    };
+
+}
+
+#endif // NETWORKBUILDER_H
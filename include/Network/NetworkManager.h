@@ -2,13 +2,33 @@
 #define NETWORKMANAGER_H
 
 #include <vector>
+#include <functional>
 #include <memory>
+#include <random>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <ostream>
 #include "Core/INeuron.h"
 #include "Core/ISynapse.h"
 #include "Core/SpikeEvent.h"
 #include "Core/EventManager.h"
+#include "Core/AxonEvent.h"
 #include "Core/NetworkConfig.h"
+#include "Core/Logger.h"
+#include "Core/Recorder.h"
+#include "Core/Profiler.h"
+#include "Core/HardwareCounters.h"
+#include "Core/PopulationStatistics.h"
+#include "Core/StateProbe.h"
+#include "Network/ISpikeTransport.h"
+#include "Network/NetworkBuilder.h"
+#include "Network/SynapseIndex.h"
+#include "Network/NeuronOrdering.h"
+#include "Network/ProceduralProjection.h"
+#include "Parallel/NumaTopology.h"
+#include "Parallel/SimulationThreadPool.h"
+#include "Parallel/WorkStealingScheduler.h"
 #include "ConnectivityStrategies/IConnectivityStrategy.h"  // Incluimos la definición completa
 
 namespace BioNeuralNetwork {
@@ -18,9 +38,92 @@ namespace BioNeuralNetwork {
         Izhikevich
     };
 
+    enum class DeliveryMode {
+        Events,     // Un evento de axón por spike y retardo en la cola (por defecto)
+        Dense,      // Bitset de los spikes de cada paso, recorrido por retardo
+        Adaptive    // En cada paso, la más barata según los spikes emitidos
+    };
+
+    /**
+     * @brief Spike emitido durante un paso de la simulación incremental.
+     */
+    struct EmittedSpike {
+        std::size_t neuronIndex; // Índice de la neurona en getNeurons()
+        long long tick;          // Paso en el que se produjo el disparo
+    };
+
+    /**
+     * @brief Configuración de la ejecución multihilo.
+     */
+    struct ParallelConfig {
+        std::size_t numThreads = 1;        // 1: ejecución secuencial en el hilo llamante
+        bool pinThreads = true;            // Fijar cada hilo a una CPU
+        bool numaFirstTouch = true;        // Recrear cada partición desde su hilo propietario
+        bool transparentHugePages = false; // madvise(MADV_HUGEPAGE) sobre la arena de cada partición
+        std::size_t fanOutChunkSize = 256; // Sinapsis por trozo al repartir con robo de trabajo la entrega y el STDP
+        bool minDelayWindows = false;      // Sincronizar los hilos una vez por ventana de retardo mínimo
+    };
+
+    /**
+     * @brief Ubicación de una partición tras la colocación en memoria.
+     */
+    struct PartitionPlacement {
+        std::size_t worker;
+        int cpu;                   // -1 si el hilo no está fijado
+        int node;                  // Nodo NUMA del hilo propietario
+        std::size_t firstNeuron;
+        std::size_t endNeuron;     // Exclusivo
+        std::size_t synapses;      // Sinapsis cuya neurona post pertenece a la partición
+        std::size_t sampledPages;  // Páginas consultadas con move_pages
+        std::size_t pagesOnNode;   // De ellas, las que residen en el nodo del hilo
+        bool hugePagesAdvised;
+    };
+
+    /**
+     * @brief Contadores agregados de rendimiento de la simulación.
+     */
+    struct SimulationStats {
+        long long steps = 0;
+        double wallSeconds = 0.0;           // Tiempo real dentro de advance()
+        double simulatedMs = 0.0;
+        std::uint64_t neuronUpdates = 0;
+        std::uint64_t synapticEvents = 0;   // Eventos entregados a sinapsis
+        long long skippedSteps = 0;         // Pasos saltados por inactividad (incluidos en steps)
+        std::uint64_t prunedSynapses = 0;   // Eliminadas por plasticidad estructural
+        std::uint64_t grownSynapses = 0;    // Creadas por plasticidad estructural
+        std::uint64_t threadSynchronizations = 0; // Regiones paralelas de integración (0 sin hilos)
+        long long denseDeliverySteps = 0;   // Pasos cuyos spikes se entregaron desde el bitset
+        std::vector<std::uint64_t> deliveryChunksByWorker; // Trozos de entrega de spikes ejecutados por cada hilo
+        double placementSeconds = 0.0;      // Recolocación de la red en memoria (fuera de wallSeconds)
+
+        double neuronUpdatesPerSecond() const { return wallSeconds > 0.0 ? neuronUpdates / wallSeconds : 0.0; }
+        double synapticEventsPerSecond() const { return wallSeconds > 0.0 ? synapticEvents / wallSeconds : 0.0; }
+        // Segundos simulados por segundo real (>1: más rápido que tiempo real)
+        double realTimeFactor() const { return wallSeconds > 0.0 ? (simulatedMs / 1000.0) / wallSeconds : 0.0; }
+    };
+
+    struct StructuralPlasticityConfig {
+        double reviewInterval = 100.0;   // ms entre revisiones
+        double pruneAfter = 500.0;       // ms seguidos en el peso mínimo antes de podar
+        double growthProbability = 0.0;  // Por neurona que disparó desde la revisión anterior; 0 sin crecimiento
+        double growthWeight = 0.5;
+        double growthDelay = 1.0;
+        std::uint64_t seed = 1;
+        // Signo de las sinapsis que crece cada neurona, por orden de creación (true:
+        // inhibitoria). Sin entrada, el de sus sinapsis salientes; si no tiene, no crece
+        std::vector<bool> inhibitoryNeurons;
+    };
+
+    struct PopulationTiming {
+        int stepMultiple = 1;               // Pasos base por paso de integración de la población
+        double izhikevichSubstep = 0.1;     // ms; subpaso interno de Izhikevich (0: sin subdividir)
+    };
+
     class NetworkManager {
     public:
         NetworkManager() = default;
+        // Vacía las listas de sinapsis de sus neuronas para liberar la red (ver releaseGraph)
+        ~NetworkManager();
 
         std::shared_ptr<INeuron> createNeuron(NeuronType type, const std::vector<double>& params = {});
 
@@ -35,11 +138,344 @@ namespace BioNeuralNetwork {
                                double weight = 1.0,
                                double delay = 1.0);
 
+        /**
+         * @brief Crea de una vez las sinapsis de un NetworkBuilder.
+         *
+         * Equivale a llamar a connectExcitatory/connectInhibitory arista a arista
+         * en el orden del builder, pero reserva las listas de cada neurona a partir
+         * de los grados (ordenación por conteo por pre y por post) y crea las
+         * sinapsis en paralelo si hay hilos configurados. Los índices del builder
+         * se refieren a endpoints; por defecto, a las neuronas de la red.
+         */
+        void addConnections(const NetworkBuilder& builder);
+        void addConnections(const NetworkBuilder& builder, const std::vector<std::shared_ptr<INeuron>>& endpoints);
+
+        /**
+         * @brief Añade una proyección aleatoria estática que no materializa sinapsis.
+         *
+         * Sus destinos se regeneran en cada spike y su corriente se entrega con
+         * la misma temporización que los eventos sinápticos. Los índices son los
+         * de getNeurons(); no admite reorderNeurons posteriores.
+         */
+        void addProceduralProjection(const ProceduralProjectionConfig& config);
+        const std::vector<ProceduralProjection>& getProceduralProjections() const { return proceduralProjections; }
+
+        /**
+         * @brief Índice hash opcional de sinapsis por par (pre, post) de getNeurons().
+         *
+         * Con el índice activo las consultas por par son O(1); sin él recorren la
+         * lista saliente de pre. Se mantiene al crear, podar, reordenar o recolocar
+         * sinapsis. Si hay varias sinapsis pre -> post se usa la primera de la lista
+         * saliente. En modo distribuido solo se encuentran las de destino local.
+         */
+        void enableSynapseIndex();
+        void disableSynapseIndex();
+        bool isSynapseIndexEnabled() const { return synapseIndexEnabled; }
+
+        ISynapse* findSynapse(std::size_t pre, std::size_t post) const;
+        bool isConnected(std::size_t pre, std::size_t post) const { return findSynapse(pre, post) != nullptr; }
+        double getSynapseWeight(std::size_t pre, std::size_t post) const;
+        void setSynapseWeight(std::size_t pre, std::size_t post, double weight);
+
+        // Conecta pre -> post solo si aún no hay sinapsis entre ellas; devuelve si la creó
+        bool connectIfAbsent(std::size_t pre, std::size_t post, double weight = 1.0, double delay = 1.0,
+                             bool excitatory = true);
+
         void setConnectivityStrategy(std::unique_ptr<IConnectivityStrategy> strategy);
         void applyConnectivityStrategy();
 
         void runSimulation(double tMax, double dt);
 
+        /**
+         * @brief Avanza la simulación hasta el paso untilTick (exclusivo).
+         *
+         * Conserva todo el estado entre llamadas (tiempo, cola de eventos,
+         * corrientes pendientes) y no realiza ninguna escritura a disco.
+         */
+        void advance(long long untilTick);
+
+        void setTimeStep(double dt);
+        double getTimeStep() const { return timeStep; }
+
+        long long getCurrentTick() const { return currentTick; }
+        double getCurrentTime() const { return currentTick * timeStep; }
+
+        // Corriente de fondo inyectada a todas las neuronas en cada paso
+        void setBackgroundCurrent(double current) { backgroundCurrent = current; }
+        double getBackgroundCurrent() const { return backgroundCurrent; }
+
+        /**
+         * @brief Dinámica de la entrada sináptica de todas las neuronas, actuales y futuras.
+         *
+         * Por defecto es instantánea. Con núcleos exponenciales cada neurona guarda
+         * una corriente o conductancia por receptor que decae una vez por paso. Las
+         * proyecciones procedurales siguen inyectando corriente instantánea.
+         */
+        void setSynapticModel(const SynapticModel& model);
+        const SynapticModel& getSynapticModel() const { return synapticModel; }
+
+        /**
+         * @brief Salta los intervalos inactivos en lugar de integrar paso a paso.
+         *
+         * Si no hay eventos en tránsito ni corriente externa pendiente y todas las
+         * neuronas garantizan no disparar con la corriente de fondo, el tiempo avanza
+         * de golpe: LIF con su forma cerrada y las de Izhikevich solo si están en
+         * reposo (derivadas por debajo de tolerance). El resultado puede diferir del
+         * paso a paso en el redondeo. No se aplica en modo distribuido.
+         *
+         * Izhikevich no tiene forma cerrada ni actualización en bloque acotada: solo
+         * hay reposo si la corriente de fondo está bajo la reobase (R·I <= 4 con los
+         * parámetros por defecto). Con la corriente de fondo por defecto (10) dispara
+         * de forma tónica y una red con neuronas de Izhikevich nunca salta pasos.
+         */
+        void setQuiescentSkipping(bool enable, double tolerance = 1e-6);
+        bool isQuiescentSkipping() const { return quiescentSkipping; }
+
+        /**
+         * @brief Entrega de spikes por eventos, por bitset denso o adaptativa.
+         *
+         * En modo denso los spikes de un paso se guardan como un bitset de
+         * neuronas; en cada paso se recorren, para cada retardo distinto de la
+         * red (en pasos), los grupos de sinapsis de ese retardo y se entregan
+         * los de las neuronas marcadas en el bitset del paso de emisión
+         * correspondiente: un producto de la conectividad por el vector de
+         * spikes. Sustituye a insertar y extraer un evento por spike y retardo,
+         * lo que compensa cuando dispara una fracción grande de la red. En modo
+         * adaptativo cada paso compara ese coste (limpiar el bitset y recorrer
+         * todos los grupos) con el de la cola para sus spikes.
+         *
+         * La llegada de un retardo es ceil(retardo / dt) pasos, como en las
+         * proyecciones procedurales. Los spikes del bitset se entregan
+         * intercalados con los de la cola por paso de emisión, de modo que
+         * con retardos múltiplos de dt el resultado es idéntico al de eventos.
+         * No se aplica en modo distribuido ni con minDelayWindows.
+         */
+        void setDeliveryMode(DeliveryMode mode) { deliveryMode = mode; }
+        DeliveryMode getDeliveryMode() const { return deliveryMode; }
+
+        /**
+         * @brief Registra V, u o pesos de un subconjunto de neuronas o sinapsis.
+         *
+         * La primera muestra se toma al final del paso actual y después cada
+         * samplingInterval pasos; el salto de intervalos inactivos nunca se salta
+         * una muestra. Los objetivos se resuelven por índice al inicio de cada
+         * advance(). Devuelve el identificador de la sonda; cloneNetwork no copia
+         * las sondas.
+         */
+        std::size_t addProbe(const ProbeConfig& config);
+        StateProbe& getProbe(std::size_t id);
+        std::size_t getNumProbes() const { return probes.size(); }
+        void flushProbes();
+
+        /**
+         * @brief Poda y crecimiento periódicos de sinapsis.
+         *
+         * En cada revisión se eliminan las sinapsis cuyo peso lleva pruneAfter ms
+         * en su mínimo; solo se compactan las listas de las neuronas afectadas y
+         * el índice de entrega. Con growthProbability > 0, cada neurona que
+         * disparó desde la revisión anterior crea con esa probabilidad una sinapsis
+         * hacia una neurona aleatoria a la que aún no está conectada, con el signo
+         * de inhibitoryNeurons o, en su defecto, el de sus sinapsis salientes. Los
+         * grupos de retardo de las neuronas afectadas se actualizan sin reconstruir
+         * el índice ni recolocar la red: los punteros obtenidos con getNeurons()
+         * siguen siendo válidos. No se aplica en modo distribuido.
+         */
+        void enableStructuralPlasticity(const StructuralPlasticityConfig& config);
+        void disableStructuralPlasticity() { structuralPlasticity = false; }
+        bool isStructuralPlasticityEnabled() const { return structuralPlasticity; }
+
+        /**
+         * @brief Paso de integración propio de cada población, múltiplo del paso base.
+         *
+         * populations asigna una población a cada neurona de getNeurons(). Una
+         * población con stepMultiple k se integra solo en los pasos base t con
+         * (t + 1) % k == 0, con dt = k * paso base desde el inicio de su ventana;
+         * la corriente de fondo actúa durante toda la ventana y las corrientes
+         * externas y sinápticas instantáneas se promedian en ella, de modo que un
+         * PSP no depende de k. Sus spikes se emiten en ese paso base, que es
+         * también su tiempo de disparo, por lo que el intercambio y los retardos
+         * siguen en la rejilla común. El salto de intervalos inactivos avanza cada
+         * neurona con su propio paso. Las neuronas añadidas después se integran
+         * en cada paso base.
+         */
+        void setPopulationTiming(const std::vector<std::size_t>& populations,
+                                 const std::vector<PopulationTiming>& timing);
+        int getStepMultiple(std::size_t neuronIndex) const;
+
+        // Corriente externa que se aplicará a la neurona en el siguiente paso
+        void injectExternalCurrent(std::size_t neuronIndex, double current);
+
+        // Spikes emitidos durante la última llamada a advance()
+        const std::vector<EmittedSpike>& getRecentSpikes() const {
+            return recentSpikes;
+        }
+
+        /**
+         * @brief Activa las estadísticas de población en línea.
+         *
+         * populations asigna una población a cada neurona según su orden de
+         * creación (vacío: una sola población). Las neuronas creadas después se
+         * suman a la única población o, con asignación explícita, a una población
+         * propia que sigue a las asignadas. Es independiente del registro de
+         * spikes del Logger, que puede desactivarse. En modo distribuido solo se
+         * cuentan las neuronas locales.
+         */
+        void enablePopulationStatistics(const PopulationStatisticsConfig& config = {},
+                                        const std::vector<std::size_t>& populations = {});
+        void disablePopulationStatistics() { populationStatistics.reset(); }
+        const PopulationStatistics* getPopulationStatistics() const { return populationStatistics.get(); }
+
+        /**
+         * @brief Logger de esta red (por defecto, ninguno: la red no registra nada).
+         *
+         * Es el primer recorder de la red; con un Logger por red varias
+         * simulaciones pueden ejecutarse a la vez sin compartir registros.
+         * La red no lo posee: debe seguir vivo mientras la red (y sus copias
+         * de cloneNetwork) simulen. nullptr lo desactiva.
+         */
+        void setLogger(Logger* newLogger);
+        Logger* getLogger() const { return logger; }
+
+        /**
+         * @brief Recorders adicionales que reciben los spikes y los cambios de peso.
+         *
+         * Los modelos no registran nada: la red emite cada spike al cerrar su
+         * paso y, al aplicar el STDP, el cambio de peso de cada sinapsis. Las
+         * sinapsis no guardan el recorder; cada bucle de plasticidad elige una
+         * vez si registra, de modo que sin Logger ni recorders no hay ninguna
+         * comprobación por sinapsis. La red comparte la propiedad de los
+         * recorders, que viven al menos tanto como ella.
+         */
+        void addRecorder(std::shared_ptr<IRecorder> recorder);
+        void clearRecorders();
+        const std::vector<std::shared_ptr<IRecorder>>& getRecorders() const { return recorders; }
+        void flushRecorders();
+
+        /**
+         * @brief Copia independiente de la red: neuronas (con su estado e IDs),
+         *        sinapsis, paso de tiempo y corriente de fondo.
+         *
+         * Requiere la cola de eventos vacía y no estar en modo distribuido. La
+         * copia usa el mismo Logger y recorders, y la configuración multihilo
+         * por defecto.
+         */
+        std::unique_ptr<NetworkManager> cloneNetwork() const;
+
+        // Si está activo, runSimulation exporta los logs al terminar
+        void setExportLogsOnFinish(bool enable) { exportLogsOnFinish = enable; }
+
+        /**
+         * @brief Renumera las neuronas para que las conectadas queden próximas en memoria.
+         *
+         * Las neuronas y sinapsis se vuelven a crear en el nuevo orden (conservando
+         * estado, pesos e IDs, por lo que el Logger sigue informando los IDs
+         * originales). Las sondas traducen sus índices y siguen registrando las
+         * mismas neuronas y sinapsis. Debe llamarse con la cola de eventos vacía
+         * y fuera del modo distribuido.
+         */
+        void reorderNeurons(NeuronOrdering method);
+
+        // Índice de creación original de la neurona que ocupa ahora la posición index
+        std::size_t getOriginalIndex(std::size_t index) const;
+
+        // Distancia media |pre - post| entre índices de neuronas conectadas
+        double getMeanSynapticIndexDistance() const;
+
+        const SimulationStats& getStats() const { return stats; }
+        void resetStats() { stats = SimulationStats{}; }
+
+        /**
+         * @brief Tiempos por fase y por hilo. Solo se rellenan si la biblioteca se
+         *        compila con BNN_ENABLE_PROFILING; en otro caso no tienen coste.
+         */
+        Profiler& getProfiler() { return profiler; }
+        const Profiler& getProfiler() const { return profiler; }
+
+        /**
+         * @brief Activa los contadores de hardware (ciclos, instrucciones, fallos de
+         *        caché de último nivel y de predicción de saltos) por fase.
+         *
+         * Devuelve false si el sistema no permite perf_event_open; la simulación
+         * sigue igual y getHardwareCounters() informa de que no están disponibles.
+         */
+        bool setHardwareCountersEnabled(bool enabled);
+        const HardwareCounterProfiler* getHardwareCounters() const { return hardwareCounters.get(); }
+
+        /**
+         * @brief Configura la ejecución multihilo.
+         *
+         * Las neuronas se reparten en bloques contiguos, uno por hilo. Con
+         * numaFirstTouch, antes del siguiente paso cada hilo vuelve a crear sus
+         * neuronas y las sinapsis que llegan a ellas, de modo que la memoria queda
+         * en su nodo NUMA. Los punteros obtenidos antes de la colocación dejan de
+         * formar parte de la red: tras ella debe usarse getNeurons(). Los eventos
+         * de cada paso se entregan en paralelo cuando suman al menos dos trozos de
+         * fanOutChunkSize sinapsis: cada trozo es un rango de neuronas post y los
+         * hilos se los reparten con robo de trabajo. Si un grupo de retardo llega a
+         * esos dos trozos (p. ej. el spike de un hub), sus neuronas post se cortan
+         * cada fanOutChunkSize sinapsis (como mucho 16 trozos por hilo); si no, hay
+         * un trozo por partición. Cada neurona post recibe su entrada en el orden
+         * de la ejecución en serie y el resultado es el mismo.
+         *
+         * Con minDelayWindows cada hilo integra su partición durante toda una
+         * ventana de retardo mínimo (getExchangeWindowSteps() pasos) sin esperar
+         * a los demás: ningún spike de la ventana puede llegar antes de que
+         * termine. Cada hilo entrega la corriente de los eventos dirigidos a sus
+         * neuronas; el STDP de la ventana y la propagación de sus spikes se hacen
+         * en la frontera, en el orden de la ejecución paso a paso y con los
+         * tiempos de disparo de cada paso. La diferencia es que los pesos
+         * modificados en una ventana solo actúan sobre la corriente a partir de
+         * la siguiente. El resultado no depende del número de hilos (también se
+         * admite con uno). Las ventanas se acortan en las muestras de las sondas
+         * y en las revisiones estructurales. En modo distribuido se usan siempre
+         * que la ventana supere un paso, con o sin esta opción.
+         */
+        void setParallelConfig(const ParallelConfig& config);
+        const ParallelConfig& getParallelConfig() const { return parallelConfig; }
+
+        /**
+         * @brief Vuelve a colocar la red en memoria en el siguiente advance() con hilos.
+         *
+         * La red se coloca al configurar los hilos y al reordenar las neuronas;
+         * las neuronas y sinapsis creadas después (incluida la plasticidad
+         * estructural) se quedan donde las creó su hilo hasta esta llamada, que
+         * vuelve a crear todos los objetos: los punteros anteriores dejan de ser
+         * los de la red, y las neuronas anteriores quedan sin sinapsis y se liberan
+         * junto con sus arenas en cuanto nadie más las retiene.
+         */
+        void relocateMemory() { placementDirty = true; }
+
+        // Resultado de la última colocación en memoria
+        const std::vector<PartitionPlacement>& getPlacementReport() const { return placementReport; }
+        void printPlacementReport(std::ostream& out) const;
+
+        /**
+         * @brief Activa el modo distribuido. Debe llamarse antes de crear las sinapsis.
+         *
+         * Cada rank crea todas las neuronas, pero solo integra las propias
+         * (índice % size == rank) y solo guarda las sinapsis cuya neurona post es
+         * local. Los spikes se intercambian una vez por ventana de retardo mínimo.
+         * Todas las llamadas a advance() deben repetirse igual en todos los ranks.
+         *
+         * Con ventanas de un paso el resultado es idéntico al de un solo proceso.
+         * Con ventanas más largas, el STDP de un paso leería tiempos de disparo
+         * que otro rank solo publica al final de la ventana; se usan entonces las
+         * ventanas de minDelayWindows (véase setParallelConfig): el intercambio
+         * se hace antes de rehacer el STDP, con el paso real de cada spike, y el
+         * resultado es idéntico al de un solo proceso con minDelayWindows. Como
+         * las muestras de las sondas acortan las ventanas, las sondas deben
+         * añadirse igual en todos los ranks.
+         */
+        void setSpikeTransport(std::shared_ptr<ISpikeTransport> transport);
+
+        bool isLocalNeuron(std::size_t index) const;
+
+        // Pasos por ventana de intercambio (retardo mínimo / dt)
+        long long getExchangeWindowSteps() const { return windowSteps; }
+
+        // Eventos de axón en la cola: uno por (spike, grupo de retardo), no por sinapsis
+        std::size_t getQueuedEventCount() const { return eventManager.size(); }
+
         const std::vector<std::shared_ptr<INeuron>>& getNeurons() const {
             return neurons;
         }
@@ -49,11 +485,188 @@ namespace BioNeuralNetwork {
     private:
         std::vector<std::shared_ptr<INeuron>> neurons;
         std::vector<std::shared_ptr<ISynapse>> synapses;
+        Logger* logger = nullptr;
+        std::vector<std::shared_ptr<IRecorder>> recorders;
+        RecorderSet recorderFanOut;
+        IRecorder* activeRecorder = nullptr;   // Logger, único recorder, fan-out o nullptr
+        std::vector<double> firedSpikeTimes;                    // Tiempo de cada firedThisStep, solo con recorder
+
+        // Proyecciones procedurales y su corriente pendiente por paso de llegada
+        std::vector<ProceduralProjection> proceduralProjections;
+        std::vector<double> proceduralRing;   // ranura * N + post
+        std::size_t proceduralSlots = 0;
+        long long proceduralLastArrival = -1;   // Último paso con corriente procedural pendiente
+
+        bool quiescentSkipping = false;
+        double quiescentTolerance = 1e-6;
+        std::size_t quiescentBlocker = 0;       // Última neurona que impidió saltar; se comprueba primero
+
+        bool structuralPlasticity = false;
+        StructuralPlasticityConfig structuralConfig;
+        long long nextStructuralReview = 0;
+        double lastStructuralReview = 0.0;
+        std::mt19937_64 structuralRng;
 
         std::unique_ptr<IConnectivityStrategy> connectivityStrategy;
 
-        EventManager eventManager;
+        BasicEventManager<AxonEvent> eventManager;
+
+        // Sinapsis salientes agrupadas por retardo: la neurona i tiene los grupos
+        // [axonBucketBegin[i], axonBucketEnd[i]) y el grupo b abarca
+        // axonSynapses[bucketSynapseBegin[b], bucketSynapseEnd[b]). La plasticidad
+        // estructural los actualiza en su sitio o los traslada al final de los
+        // arrays; los huecos que deja se recuperan al reconstruir el índice
+        std::vector<std::size_t> axonBucketBegin;
+        std::vector<std::size_t> axonBucketEnd;
+        std::vector<double> bucketDelay;
+        std::vector<std::size_t> bucketSynapseBegin;
+        std::vector<std::size_t> bucketSynapseEnd;
+        std::vector<ISynapse*> axonSynapses;
+        std::size_t deadAxonSynapses = 0;   // Posiciones de axonSynapses sin grupo
+        std::size_t deadAxonBuckets = 0;    // Grupos sin neurona
+        bool axonIndexDirty = true;
+
+        // Grupos que se entregan en el paso actual, en el orden de la cola
+        struct BucketDelivery {
+            std::size_t bucket;
+            std::uint32_t pre;
+            double time;
+        };
+        std::vector<BucketDelivery> bucketDeliveries;
+        std::vector<std::size_t> deliveryChunkBounds; // Primera neurona post de cada trozo de entrega
+
+        bool synapseIndexEnabled = false;
+        SynapseIndex synapseIndex;
+
+        double timeStep = 1.0;
+        long long currentTick = 0;
+        double backgroundCurrent = 10.0;
+        SynapticModel synapticModel;
+        bool exportLogsOnFinish = true;
+
+        std::vector<double> externalCurrents;
+        std::vector<EmittedSpike> recentSpikes;
 
+        // Múltiplo del paso base de cada neurona (vacío: todas integran en cada paso)
+        std::vector<int> stepMultiples;
+        long long stepMultipleLcm = 1;
+
+        // Modo distribuido e intercambio por ventanas
+        std::shared_ptr<ISpikeTransport> transport;
+        std::unordered_map<const INeuron*, std::size_t> neuronIndices;
+        long long windowSteps = 0;      // 0: pendiente de calcular
+        long long stepsInWindow = 0;
+        std::vector<std::size_t> firedThisStep;
+        std::vector<RemoteSpike> pendingSpikes;
+        std::vector<RemoteSpike> remoteSpikes;
+        std::vector<RemoteSpike> windowLocalSpikes;   // Spikes locales de la ventana (minDelayWindows)
+
+        // originalIndices[i] = índice de creación de la neurona i (vacío sin reordenar)
+        std::vector<std::size_t> originalIndices;
+
+        // Ejecución multihilo
+        ParallelConfig parallelConfig;
+        NumaTopology numaTopology;
+        std::unique_ptr<SimulationThreadPool> threadPool;
+        std::unique_ptr<WorkStealingScheduler> scheduler;
+        std::vector<std::size_t> fanOutOffsets;
+        std::vector<AxonEvent> stagedEvents;
+        std::vector<std::size_t> partitionBounds;
+        std::vector<std::vector<std::size_t>> partitionFired;
+
+        // Ventanas de retardo mínimo (minDelayWindows): entregas de la ventana en
+        // el orden de la cola y, por partición de la neurona post, sus posiciones
+        struct WindowDelivery {
+            long long tick;
+            std::size_t synapse;     // Posición en axonSynapses
+            std::uint32_t pre;
+            double time;
+        };
+        std::vector<WindowDelivery> windowDeliveries;
+        std::vector<std::vector<std::size_t>> partitionDeliveries;
+        std::vector<std::vector<EmittedSpike>> partitionWindowFired;
+        std::vector<std::vector<double>> partitionWindowSpikeTimes;   // Solo con recorder
+        std::vector<double> windowStartSpikeTimes;   // getLastSpikeTime() al abrir la ventana
+        std::vector<std::uint32_t> axonSynapsePost;  // Neurona post de cada axonSynapses[k], creciente en cada grupo
+
+        // Entrega densa: bitset de los spikes de cada paso en la ranura paso % denseSlots
+        DeliveryMode deliveryMode = DeliveryMode::Events;
+        std::vector<std::uint64_t> spikeBits;    // ranura * denseWords + palabra
+        std::vector<long long> denseSlotTick;    // Paso cuyos spikes guarda cada ranura, o -1
+        std::size_t denseSlots = 0;
+        std::size_t denseWords = 0;
+        std::vector<long long> bucketSteps;      // Pasos hasta la llegada de cada grupo de retardo
+        std::vector<long long> denseOffsets;     // Valores distintos de bucketSteps, de mayor a menor
+        // Grupos no vacíos de cada retardo denseOffsets[o], por neurona pre:
+        // denseBuckets[denseOffsetBegin[o], denseOffsetBegin[o+1])
+        struct DenseBucket {
+            std::size_t bucket;
+            std::uint32_t pre;
+        };
+        std::vector<DenseBucket> denseBuckets;
+        std::vector<std::size_t> denseOffsetBegin;
+        bool denseBucketsDirty = false;          // Grupos trasladados desde el último recuento
+        long long denseLastArrival = -1;         // Último paso con spikes del bitset por entregar
+        bool placementDirty = true;
+        std::vector<PartitionPlacement> placementReport;
+
+        SimulationStats stats;
+        Profiler profiler;
+        std::unique_ptr<HardwareCounterProfiler> hardwareCounters;
+        std::unique_ptr<PopulationStatistics> populationStatistics;
+        std::size_t addedNeuronPopulation = 0;   // Población de las neuronas creadas tras activarlas
+        std::vector<std::unique_ptr<StateProbe>> probes;
+
+        void stepOnce();
+        // En modo distribuido, siempre que la ventana de intercambio supere un paso
+        bool usesMinDelayWindows() const { return transport ? windowSteps > 1 : parallelConfig.minDelayWindows; }
+        void runMinDelayWindow(long long endTick);
+        void commitFiredSpikes(double currentTime);
+        void updateRecorders();
+        bool usesDenseDelivery() const {
+            return deliveryMode != DeliveryMode::Events && !transport && !usesMinDelayWindows();
+        }
+        bool chooseDenseDelivery() const;
+        void recordDenseSpikes();
+        void deliverDenseSpikes(long long emissionTick, std::size_t offset);
+        void rebuildDenseBuckets();
+        void spillDenseSpikes();
+        void deliverAxonBuckets();
+        std::size_t findAxonBucket(const AxonEvent& event) const;
+        long long skipQuiescentSteps(long long untilTick);
+        void applyStructuralPlasticity();
+        long long reviewSteps() const;
+        void bindProbes();
+        long long nextProbeTick() const;
+        void integrateRange(std::size_t begin, std::size_t end, std::vector<std::size_t>& fired,
+                            long long tick, std::size_t threadSlot);
+        void integrateMultiRateRange(std::size_t begin, std::size_t end, std::vector<std::size_t>& fired,
+                                     long long tick, std::size_t threadSlot);
+        void updatePartitions();
+        void placeMemory();
+        // Las sinapsis guardan shared_ptr a sus neuronas y las neuronas a sus sinapsis:
+        // vaciar las listas rompe el ciclo para que la red se libere al soltarla
+        static void releaseGraph(const std::vector<std::shared_ptr<INeuron>>& graph);
+        void buildPlacementReport(bool hugePagesAdvised);
+        void updateExchangeWindow();
+        void flushSpikeWindow();
+        void propagateWindowSpikes();
+        void resizeProceduralRing();
+        void propagateProcedural();
+        void deliverProceduralCurrents(std::size_t begin, std::size_t end, long long tick);
+        void rebuildAxonIndex();
+        void removeAxonSynapses(const std::vector<std::size_t>& pres,
+                                const std::unordered_set<const ISynapse*>& pruned);
+        void insertAxonSynapse(std::size_t pre, std::size_t post, ISynapse* synapse);
+        void propagateSpike(std::size_t neuronIndex, double spikeTime);
+        void propagatePendingSpikes();
+        void applyPostSynapticPlasticity(double currentTime);
+        bool useChunkedFanOut(std::size_t totalSynapses) const;
+        bool acceptsConnection(const std::shared_ptr<INeuron>& post);
+        void indexSynapse(ISynapse* synapse);
+        void rebuildSynapseIndex();
+        // Reparte [0, total) en rangos contiguos entre los hilos de la red (o el llamante)
+        void forEachRange(std::size_t total, const std::function<void(std::size_t, std::size_t)>& body);
         void addNeuron(std::shared_ptr<INeuron> neuron);
         void addSynapse(std::shared_ptr<ISynapse> synapse);
     };
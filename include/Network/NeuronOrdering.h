@@ -0,0 +1,28 @@
+// include/Network/NeuronOrdering.h
+#ifndef NEURONORDERING_H
+#define NEURONORDERING_H
+
+#include <cstddef>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Métodos de renumeración de neuronas para mejorar la localidad.
+     */
+    enum class NeuronOrdering {
+        ReverseCuthillMcKee, // Minimiza el ancho de banda de la matriz de conectividad
+        DegreeDescending     // Agrupa los hubs al principio del array de estado
+    };
+
+    /**
+     * @brief Calcula una permutación de neuronas a partir de su grafo de conectividad.
+     * @param adjacency Lista de vecinos (no dirigida, sin duplicados) de cada neurona.
+     * @return order[nuevoÍndice] = índice original.
+     */
+    std::vector<std::size_t> computeNeuronOrdering(const std::vector<std::vector<std::size_t>>& adjacency,
+                                                   NeuronOrdering method);
+
+}
+
+#endif // NEURONORDERING_H
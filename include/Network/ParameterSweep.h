@@ -0,0 +1,82 @@
+// include/Network/ParameterSweep.h
+#ifndef PARAMETERSWEEP_H
+#define PARAMETERSWEEP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Core/NetworkConfig.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    enum class SweepParameter {
+        BackgroundCurrent,   // Corriente de fondo de la red
+        StdpAPlus,           // Amplitud de potenciación de todas las sinapsis
+        StdpAMinus,          // Amplitud de depresión de todas las sinapsis
+        IzhikevichA,         // Parámetro a de todas las neuronas de Izhikevich
+        IzhikevichD          // Parámetro d de todas las neuronas de Izhikevich
+    };
+
+    const char* toString(SweepParameter parameter);
+
+    struct SweepAxis {
+        SweepParameter parameter;
+        std::vector<double> values;
+    };
+
+    struct SweepConfig {
+        double tMax = 1000.0;        // Duración de cada ejecución (ms)
+        double dt = 1.0;
+        std::size_t numThreads = 0;  // 0: std::thread::hardware_concurrency()
+        bool pinThreads = false;
+    };
+
+    struct SweepRunResult {
+        std::vector<double> values;         // Un valor por eje, en el orden de los ejes
+        int spikes = 0;
+        int weightChanges = 0;
+        double meanRate = 0.0;              // Hz por neurona
+        double meanExcitatoryWeight = 0.0;  // Al final de la ejecución
+        std::uint64_t synapticEvents = 0;
+        double wallSeconds = 0.0;
+    };
+
+    /**
+     * @brief Barrido de parámetros sobre una topología construida una sola vez.
+     *
+     * Cada punto del producto cartesiano de los ejes es una ejecución
+     * independiente: parte de una copia de la red (cloneNetwork) con su propio
+     * estado y su propio Logger, por lo que las ejecuciones se reparten entre
+     * los hilos sin interferir. Los resultados agregados se escriben en un único
+     * CSV por barrido.
+     */
+    class ParameterSweep {
+    public:
+        ParameterSweep(const NetworkConfig& network, std::vector<SweepAxis> axes, const SweepConfig& config = {});
+
+        std::size_t getNumRuns() const;
+
+        // Valores de la ejecución run; el último eje varía más rápido
+        std::vector<double> getRunValues(std::size_t run) const;
+
+        const std::vector<SweepRunResult>& run();
+        const std::vector<SweepRunResult>& getResults() const { return results; }
+
+        void exportCSV(const std::string& filename) const;
+
+        const NetworkManager& getTopology() const { return topology; }
+
+    private:
+        SweepRunResult runOne(std::size_t run) const;
+
+        NetworkManager topology;
+        std::vector<SweepAxis> axes;
+        SweepConfig config;
+        std::vector<SweepRunResult> results;
+    };
+
+}
+
+#endif // PARAMETERSWEEP_H
@@ -0,0 +1,85 @@
+// include/Network/ProceduralProjection.h
+#ifndef PROCEDURALPROJECTION_H
+#define PROCEDURALPROJECTION_H
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include "Core/CounterRng.h"
+
+namespace BioNeuralNetwork {
+
+    struct ProceduralProjectionConfig {
+        // Rangos [begin, end) de índices de neurona
+        std::size_t preBegin = 0;
+        std::size_t preEnd = 0;
+        std::size_t postBegin = 0;
+        std::size_t postEnd = 0;
+        double connectionProbability = 0.1;
+        double minWeight = 0.5;              // Peso uniforme en [minWeight, maxWeight]
+        double maxWeight = 0.5;
+        double minDelay = 1.0;               // Retardo uniforme en [minDelay, maxDelay] (ms)
+        double maxDelay = 1.0;
+        bool excitatory = true;
+        std::uint64_t seed = 1;
+        bool allowSelfConnections = false;
+    };
+
+    /**
+     * @brief Proyección aleatoria estática sin datos por sinapsis.
+     *
+     * Los destinos, pesos y retardos de cada neurona pre se regeneran cuando
+     * dispara a partir de un CounterRng con clave (semilla, pre): siempre se
+     * obtiene la misma conectividad, pero la memoria no depende del número de
+     * sinapsis. Los destinos se recorren con saltos geométricos, así el coste
+     * por spike es proporcional al número de sinapsis y no al de neuronas post.
+     * Las proyecciones no tienen plasticidad.
+     */
+    class ProceduralProjection {
+    public:
+        explicit ProceduralProjection(const ProceduralProjectionConfig& config);
+
+        const ProceduralProjectionConfig& getConfig() const { return config; }
+
+        bool containsPre(std::size_t pre) const { return pre >= config.preBegin && pre < config.preEnd; }
+
+        // Número esperado de sinapsis de la proyección
+        double expectedSynapseCount() const;
+
+        // visit(post, pesoConSigno, retardo) para cada sinapsis de pre, en orden creciente de post
+        template <typename Visitor>
+        void forEachTarget(std::size_t pre, Visitor&& visit) const {
+            const double p = config.connectionProbability;
+            if (p <= 0.0 || !containsPre(pre)) {
+                return;
+            }
+            CounterRng rng(config.seed, pre);
+            const double sign = config.excitatory ? 1.0 : -1.0;
+            const double span = static_cast<double>(config.postEnd - config.postBegin);
+
+            double position = -1.0;
+            while (true) {
+                // Salto geométrico hasta el siguiente destino (p = 1: todos)
+                const double gap = p >= 1.0 ? 0.0 : std::floor(std::log(1.0 - rng.uniform()) / logSkip);
+                position += 1.0 + gap;
+                if (position >= span) {
+                    return;
+                }
+                const std::size_t post = config.postBegin + static_cast<std::size_t>(position);
+                const double weight = config.minWeight + (config.maxWeight - config.minWeight) * rng.uniform();
+                const double delay = config.minDelay + (config.maxDelay - config.minDelay) * rng.uniform();
+                if (post == pre && !config.allowSelfConnections) {
+                    continue;
+                }
+                visit(post, sign * weight, delay);
+            }
+        }
+
+    private:
+        ProceduralProjectionConfig config;
+        double logSkip;   // log(1 - p)
+    };
+
+}
+
+#endif // PROCEDURALPROJECTION_H
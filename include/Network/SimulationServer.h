@@ -0,0 +1,156 @@
+// include/Network/SimulationServer.h
+#ifndef SIMULATIONSERVER_H
+#define SIMULATIONSERVER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "Core/NetworkConfig.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    struct StimulusPulse {
+        std::size_t neuron;   // Índice de getNeurons()
+        double time;          // ms desde el inicio del trabajo
+        double current;
+    };
+
+    /**
+     * @brief Trabajo de simulación recibido por el servidor.
+     */
+    struct SimulationJob {
+        NetworkConfig network;
+        double duration = 1000.0;         // ms
+        double dt = 1.0;
+        double backgroundCurrent = 10.0;
+        std::vector<StimulusPulse> stimulus;
+        std::string output;               // Nombre base de los CSV del trabajo; vacío: sin ficheros
+    };
+
+    struct JobResult {
+        int spikes = 0;
+        int weightChanges = 0;
+        std::uint64_t synapticEvents = 0;
+        bool cacheHit = false;
+        double buildSeconds = 0.0;        // Construcción o copia de la red
+        double runSeconds = 0.0;
+    };
+
+    /**
+     * @brief Caché LRU de redes ya construidas, indexada por su configuración.
+     *
+     * Guarda una red plantilla por configuración (sin ejecutar) y entrega a cada
+     * trabajo una copia con cloneNetwork(), de modo que varios trabajos pueden
+     * usar la misma plantilla a la vez. Las configuraciones sin semilla fija
+     * generan una topología distinta cada vez y no se guardan.
+     */
+    class NetworkCache {
+    public:
+        explicit NetworkCache(std::size_t capacity);
+
+        std::unique_ptr<NetworkManager> acquire(const NetworkConfig& config, bool* hit = nullptr);
+        // Plantilla guardada para la configuración, sin copiarla ni tocar el orden LRU (nullptr si no está)
+        std::shared_ptr<const NetworkManager> find(const NetworkConfig& config) const;
+
+        std::size_t size() const;
+        std::uint64_t getHits() const { return hits.load(); }
+        std::uint64_t getMisses() const { return misses.load(); }
+
+        // Representación canónica de la configuración: clave de la caché
+        static std::string makeKey(const NetworkConfig& config);
+
+    private:
+        struct Entry {
+            std::string key;
+            std::shared_ptr<const NetworkManager> network;
+        };
+
+        std::size_t capacity;
+        mutable std::mutex mtx;
+        std::list<Entry> entries;   // Más reciente al principio
+        std::unordered_map<std::string, std::list<Entry>::iterator> lookup;
+        std::atomic<std::uint64_t> hits{0};
+        std::atomic<std::uint64_t> misses{0};
+    };
+
+    struct ServerConfig {
+        std::string socketPath;
+        std::size_t numWorkers = 4;
+        std::size_t cacheCapacity = 8;
+        std::string outputDirectory = ".";   // Donde se escriben los CSV de cada trabajo
+        int idleTimeoutMs = 30000;           // Conexión sin datos durante este tiempo: se cierra (0: sin límite)
+    };
+
+    /**
+     * @brief Servidor de simulación de larga duración sobre un socket de dominio Unix.
+     *
+     * Protocolo de texto, una línea por petición y por respuesta. Una petición es
+     * una lista de clave=valor separados por espacios (neurons, excitatory_ratio,
+     * inhibitory_ratio, strategy, exc_probability, exc_weight, inh_probability,
+     * inh_weight, seed, duration, dt, background, output y stimulus como
+     * neurona:ms:corriente separados por comas), o "shutdown". La respuesta es
+     * "ok" seguido de clave=valor con el resultado, o "error <mensaje>".
+     *
+     * Cada conexión la atiende un hilo del grupo de trabajadores, que la cierra si
+     * pasa idleTimeoutMs sin recibir datos para no quedar retenido por clientes
+     * inactivos; cada trabajo
+     * tiene su propia copia de la red y su propio Logger, y con output escribe
+     * <outputDirectory>/<output>_spikes.csv y _weight_changes.csv en segundo plano.
+     */
+    class SimulationServer {
+    public:
+        explicit SimulationServer(const ServerConfig& config);
+        ~SimulationServer();
+
+        SimulationServer(const SimulationServer&) = delete;
+        SimulationServer& operator=(const SimulationServer&) = delete;
+
+        void start();
+        void requestStop();
+        void wait();   // Hasta que se pida parar; después cierra todos los hilos
+        void stop() { requestStop(); wait(); }
+
+        JobResult runJob(const SimulationJob& job);
+        std::string handleRequest(const std::string& line);
+
+        const NetworkCache& getCache() const { return cache; }
+        std::uint64_t getCompletedJobs() const { return completedJobs.load(); }
+
+        static SimulationJob parseJob(const std::string& line);
+
+        // Cliente mínimo: envía una línea y devuelve la respuesta
+        static std::string sendRequest(const std::string& socketPath, const std::string& request,
+                                       int timeoutMs = 60000);
+
+    private:
+        void acceptLoop();
+        void workerLoop();
+        void serveClient(int fd);
+
+        ServerConfig config;
+        NetworkCache cache;
+
+        int listener = -1;
+        std::thread acceptor;
+        std::vector<std::thread> workers;
+
+        std::mutex mtx;
+        std::condition_variable queueCv;
+        std::condition_variable stopCv;
+        std::deque<int> pendingClients;
+        std::atomic<bool> stopping{false};
+        std::atomic<std::uint64_t> completedJobs{0};
+    };
+
+}
+
+#endif // SIMULATIONSERVER_H
@@ -0,0 +1,146 @@
+// include/Network/SynapseIndex.h
+#ifndef SYNAPSEINDEX_H
+#define SYNAPSEINDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    class ISynapse;
+
+    /**
+     * @brief Tabla hash de direccionamiento abierto indexada por el par (pre, post).
+     *
+     * Las claves son los dos índices de neurona empaquetados en 64 bits; el sondeo
+     * es lineal sobre un array contiguo con factor de carga máximo 1/2 y el
+     * borrado desplaza hacia atrás los elementos siguientes, sin marcas de borrado.
+     * Guarda un único valor por par: insert no sobrescribe uno existente.
+     */
+    template <typename Value>
+    class PairIndex {
+    public:
+        std::size_t size() const { return count; }
+        bool empty() const { return count == 0; }
+
+        void clear() {
+            slots.clear();
+            count = 0;
+        }
+
+        void reserve(std::size_t pairs) {
+            std::size_t capacity = 16;
+            while (capacity < 2 * pairs) {
+                capacity *= 2;
+            }
+            if (capacity > slots.size()) {
+                rehash(capacity);
+            }
+        }
+
+        const Value* find(std::uint32_t pre, std::uint32_t post) const {
+            if (slots.empty()) {
+                return nullptr;
+            }
+            const std::uint64_t key = pack(pre, post);
+            for (std::size_t s = home(key);; s = (s + 1) & mask()) {
+                if (slots[s].key == key) {
+                    return &slots[s].value;
+                }
+                if (slots[s].key == kEmpty) {
+                    return nullptr;
+                }
+            }
+        }
+
+        Value* find(std::uint32_t pre, std::uint32_t post) {
+            return const_cast<Value*>(static_cast<const PairIndex&>(*this).find(pre, post));
+        }
+
+        bool contains(std::uint32_t pre, std::uint32_t post) const { return find(pre, post) != nullptr; }
+
+        // Devuelve false (sin cambiar nada) si el par ya estaba
+        bool insert(std::uint32_t pre, std::uint32_t post, const Value& value) {
+            if (2 * (count + 1) > slots.size()) {
+                rehash(slots.empty() ? 16 : 2 * slots.size());
+            }
+            const std::uint64_t key = pack(pre, post);
+            std::size_t s = home(key);
+            for (; slots[s].key != kEmpty; s = (s + 1) & mask()) {
+                if (slots[s].key == key) {
+                    return false;
+                }
+            }
+            slots[s] = Slot{key, value};
+            ++count;
+            return true;
+        }
+
+        bool erase(std::uint32_t pre, std::uint32_t post) {
+            if (slots.empty()) {
+                return false;
+            }
+            const std::uint64_t key = pack(pre, post);
+            std::size_t s = home(key);
+            for (; slots[s].key != key; s = (s + 1) & mask()) {
+                if (slots[s].key == kEmpty) {
+                    return false;
+                }
+            }
+            // Desplazar hacia atrás los elementos cuya posición ideal queda antes del hueco
+            for (std::size_t next = (s + 1) & mask(); slots[next].key != kEmpty; next = (next + 1) & mask()) {
+                const std::size_t ideal = home(slots[next].key);
+                if (((next - ideal) & mask()) >= ((next - s) & mask())) {
+                    slots[s] = slots[next];
+                    s = next;
+                }
+            }
+            slots[s].key = kEmpty;
+            --count;
+            return true;
+        }
+
+    private:
+        static constexpr std::uint64_t kEmpty = std::numeric_limits<std::uint64_t>::max();
+
+        struct Slot {
+            std::uint64_t key = kEmpty;
+            Value value{};
+        };
+
+        static std::uint64_t pack(std::uint32_t pre, std::uint32_t post) {
+            return (static_cast<std::uint64_t>(pre) << 32) | post;
+        }
+
+        std::size_t mask() const { return slots.size() - 1; }
+
+        // Hash de Fibonacci: mezcla los bits altos (pre) con los bajos (post)
+        std::size_t home(std::uint64_t key) const {
+            return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & mask();
+        }
+
+        void rehash(std::size_t capacity) {
+            std::vector<Slot> old;
+            old.swap(slots);
+            slots.assign(capacity, Slot{});
+            count = 0;
+            for (const Slot& slot : old) {
+                if (slot.key != kEmpty) {
+                    insert(static_cast<std::uint32_t>(slot.key >> 32), static_cast<std::uint32_t>(slot.key),
+                           slot.value);
+                }
+            }
+        }
+
+        std::vector<Slot> slots;   // Tamaño potencia de dos (o vacío)
+        std::size_t count = 0;
+    };
+
+    // Primera sinapsis de cada par en el orden de las listas salientes
+    using SynapseIndex = PairIndex<ISynapse*>;
+
+}
+
+#endif // SYNAPSEINDEX_H
@@ -0,0 +1,60 @@
+// include/Network/UnixSocketTransport.h
+#ifndef UNIXSOCKETTRANSPORT_H
+#define UNIXSOCKETTRANSPORT_H
+
+#include <memory>
+#include <string>
+#include <vector>
+#include "Network/ISpikeTransport.h"
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Transporte de spikes sobre sockets de dominio Unix (malla completa entre ranks).
+     */
+    class UnixSocketTransport : public ISpikeTransport {
+    public:
+        /**
+         * @brief Crea un grupo de ranks conectados con socketpair().
+         *
+         * Pensado para lanzar los ranks con fork(): cada proceso conserva su
+         * elemento y destruye el resto para cerrar los descriptores ajenos.
+         */
+        static std::vector<std::unique_ptr<UnixSocketTransport>> createLocalGroup(int size);
+
+        /**
+         * @brief Conecta procesos independientes a través de sockets en un directorio.
+         *
+         * Cada rank escucha en <socketDirectory>/rank_<r>.sock y se conecta a los
+         * ranks de número inferior.
+         */
+        static std::unique_ptr<UnixSocketTransport> connect(const std::string& socketDirectory,
+                                                            int rank, int size,
+                                                            int timeoutMs = 10000);
+
+        ~UnixSocketTransport() override;
+
+        UnixSocketTransport(const UnixSocketTransport&) = delete;
+        UnixSocketTransport& operator=(const UnixSocketTransport&) = delete;
+
+        int getRank() const override { return rank; }
+        int getSize() const override { return static_cast<int>(peers.size()); }
+
+        void exchange(const std::vector<RemoteSpike>& outgoing,
+                      std::vector<RemoteSpike>& incoming) override;
+
+        double minAcrossRanks(double value) override;
+
+    private:
+        UnixSocketTransport(int rank, std::vector<int> peerFds);
+
+        // Envía el mismo bloque a todos los pares y recibe un bloque de cada uno
+        void allToAll(const std::vector<char>& payload, std::vector<std::vector<char>>& received);
+
+        int rank;
+        std::vector<int> peers; // Descriptor por rank; -1 para el propio
+    };
+
+}
+
+#endif // UNIXSOCKETTRANSPORT_H
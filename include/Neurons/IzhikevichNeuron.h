@@ -2,6 +2,7 @@
 #ifndef IZHIKEVICHNEURON_H
 #define IZHIKEVICHNEURON_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include "Core/INeuron.h"
@@ -9,11 +10,28 @@
 
 namespace BioNeuralNetwork {
 
+/**
+ * @brief Parámetros del modelo de Izhikevich (en el orden del constructor)
+ */
+struct IzhikevichParameters {
+    double a;
+    double b;
+    double c;
+    double d;
+    double V_threshold;
+    double V_reset;
+    double R;
+    double C;
+    double refractoryPeriod;
+};
+
 /**
  * @brief Modelo de Neurona de Izhikevich
  */
 class IzhikevichNeuron : public INeuron {
 public:
+    static constexpr double kDefaultSubstep = 0.1; // ms
+
     IzhikevichNeuron(double a = 0.02,
                      double b = 0.2,
                      double c = -65.0,
@@ -34,11 +52,19 @@ public:
 
     void injectCurrent(double current) override;
     void resetAccumulatedCurrent() override;
+    void scaleAccumulatedCurrent(double factor) override { accumulatedCurrent *= factor; }
+
+    void receiveSynapticInput(double weight, Receptor receptor) override;
+    void setSynapticModel(const SynapticModel& model) override { synaptic.setModel(model); }
+    const SynapticModel& getSynapticModel() const override { return synaptic.getModel(); }
 
     void addIncomingSynapse(std::shared_ptr<ISynapse> synapse) override;
     void addOutgoingSynapse(std::shared_ptr<ISynapse> synapse) override;
+    void reserveSynapses(std::size_t additionalOutgoing, std::size_t additionalIncoming) override;
+    void removeSynapsesIf(const std::function<bool(const ISynapse&)>& pruned) override;
 
     int getID() const override;
+    void setID(int newID) override { id = newID; }
     const std::vector<std::shared_ptr<ISynapse>>& getOutgoingSynapses() const override;
     const std::vector<std::shared_ptr<ISynapse>>& getIncomingSynapses() const override;
 
@@ -46,8 +72,21 @@ public:
     double getMembranePotential() const override;
     double getResetPotential() const override;
 
+    long long quiescentHorizon(long long maxSteps, double dt, double current, double tolerance) const override;
+    void skipQuiescent(long long steps, double dt, double current) override;
+
+    std::shared_ptr<INeuron> clone() const override;
+    std::shared_ptr<INeuron> cloneInto(const std::shared_ptr<PlacementArena>& arena) const override;
+
+    IzhikevichParameters getParameters() const;
+    void setParameters(const IzhikevichParameters& parameters);
+
+    // Subpaso máximo de la integración interna; 0 integra cada paso de una vez
+    void setSubstep(double newSubstep);
+    double getSubstep() const { return substep; }
+
 private:
-    static int id_counter;
+    static std::atomic<int> id_counter; // Solo para neuronas creadas fuera de un NetworkManager
     int id;
 
     double a;
@@ -59,11 +98,13 @@ private:
     double R;
     double C;
     double refractoryPeriod;
+    double substep = kDefaultSubstep;
 
     double V;
     double u;
     bool fired;
     double accumulatedCurrent;
+    SynapticKernel synaptic;
     double timeSinceLastSpike;
     double lastSpikeTime;
 
@@ -2,6 +2,7 @@
 #ifndef LIFNEURON_H
 #define LIFNEURON_H
 
+#include <atomic>
 #include <memory>
 #include <vector>
 #include "Core/INeuron.h"
@@ -31,11 +32,19 @@ namespace BioNeuralNetwork {
 
         void injectCurrent(double current) override;
         void resetAccumulatedCurrent() override;
+        void scaleAccumulatedCurrent(double factor) override { accumulatedCurrent *= factor; }
+
+        void receiveSynapticInput(double weight, Receptor receptor) override;
+        void setSynapticModel(const SynapticModel& model) override { synaptic.setModel(model); }
+        const SynapticModel& getSynapticModel() const override { return synaptic.getModel(); }
 
         void addIncomingSynapse(std::shared_ptr<ISynapse> synapse) override;
         void addOutgoingSynapse(std::shared_ptr<ISynapse> synapse) override;
+        void reserveSynapses(std::size_t additionalOutgoing, std::size_t additionalIncoming) override;
+        void removeSynapsesIf(const std::function<bool(const ISynapse&)>& pruned) override;
 
         int getID() const override;
+        void setID(int newID) override { id = newID; }
         const std::vector<std::shared_ptr<ISynapse>>& getOutgoingSynapses() const override;
         const std::vector<std::shared_ptr<ISynapse>>& getIncomingSynapses() const override;
 
@@ -43,8 +52,14 @@ namespace BioNeuralNetwork {
         double getMembranePotential() const override;
         double getResetPotential() const override;
 
+        long long quiescentHorizon(long long maxSteps, double dt, double current, double tolerance) const override;
+        void skipQuiescent(long long steps, double dt, double current) override;
+
+        std::shared_ptr<INeuron> clone() const override;
+        std::shared_ptr<INeuron> cloneInto(const std::shared_ptr<PlacementArena>& arena) const override;
+
     private:
-        static int id_counter;
+        static std::atomic<int> id_counter; // Solo para neuronas creadas fuera de un NetworkManager
         int id;
 
         double V_rest;
@@ -57,6 +72,7 @@ namespace BioNeuralNetwork {
         double V_current;
         bool fired;
         double accumulatedCurrent;
+        SynapticKernel synaptic;
         double timeSinceLastSpike;
         double lastSpikeTime;
 
@@ -0,0 +1,47 @@
+// include/Parallel/NumaTopology.h
+#ifndef NUMATOPOLOGY_H
+#define NUMATOPOLOGY_H
+
+#include <cstddef>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Topología NUMA de la máquina leída de /sys (sin depender de libnuma).
+     *
+     * Si la información no está disponible se asume un único nodo con todas las
+     * CPU permitidas al proceso.
+     */
+    class NumaTopology {
+    public:
+        static NumaTopology detect();
+
+        std::size_t getNumNodes() const { return numNodes; }
+
+        // CPU permitidas al proceso, agrupadas por nodo
+        const std::vector<int>& getCpus() const { return cpus; }
+
+        int getNodeOfCpu(int cpu) const;
+
+        // Fija el hilo actual a una CPU; devuelve false si no es posible
+        static bool pinCurrentThread(int cpu);
+
+        // Nodo en el que reside la página que contiene ptr (-1 si se desconoce)
+        static int getNodeOfAddress(const void* ptr);
+
+        /**
+         * @brief Solicita páginas enormes transparentes para el rango indicado.
+         *        Solo se aplica a la parte alineada a 2 MiB; devuelve false si no aplica.
+         */
+        static bool adviseHugePages(void* ptr, std::size_t bytes);
+
+    private:
+        std::size_t numNodes = 1;
+        std::vector<int> cpus;
+        std::vector<int> cpuToNode; // Indexado por número de CPU
+    };
+
+}
+
+#endif // NUMATOPOLOGY_H
@@ -0,0 +1,78 @@
+// include/Parallel/PlacementArena.h
+#ifndef PLACEMENTARENA_H
+#define PLACEMENTARENA_H
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Memoria contigua para el estado de una partición.
+     *
+     * Reserva bloques alineados a 2 MiB y reparte su memoria de forma lineal;
+     * nada se libera hasta destruir la arena. Con hugePages se solicitan
+     * páginas enormes transparentes para cada bloque antes de tocarlo, de modo
+     * que el primer contacto del hilo propietario las coloca en su nodo. Solo
+     * un hilo asigna de cada arena.
+     */
+    class PlacementArena {
+    public:
+        explicit PlacementArena(bool hugePages, std::size_t blockBytes = 2u * 1024u * 1024u);
+        ~PlacementArena();
+
+        PlacementArena(const PlacementArena&) = delete;
+        PlacementArena& operator=(const PlacementArena&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t alignment);
+
+        std::size_t getReservedBytes() const { return reservedBytes; }
+        // true si se solicitaron páginas enormes para todos los bloques (y hay alguno)
+        bool hugePagesAdvised() const { return !blocks.empty() && advisedBlocks == blocks.size(); }
+
+    private:
+        bool hugePages;
+        std::size_t blockBytes;
+        std::vector<void*> blocks;
+        std::size_t advisedBlocks = 0;
+        std::size_t reservedBytes = 0;
+        char* cursor = nullptr;
+        std::size_t remaining = 0;
+    };
+
+    /**
+     * @brief Asignador para std::allocate_shared sobre una PlacementArena.
+     *
+     * Cada bloque de control guarda una copia del asignador, que mantiene viva
+     * la arena mientras exista alguno de sus objetos.
+     */
+    template <typename T>
+    class ArenaAllocator {
+    public:
+        using value_type = T;
+
+        explicit ArenaAllocator(std::shared_ptr<PlacementArena> arena) : arena(std::move(arena)) {}
+        template <typename U>
+        ArenaAllocator(const ArenaAllocator<U>& other) : arena(other.getArena()) {}
+
+        T* allocate(std::size_t n) {
+            return static_cast<T*>(arena->allocate(n * sizeof(T), alignof(T)));
+        }
+        // La memoria se devuelve al destruir la arena
+        void deallocate(T*, std::size_t) {}
+
+        const std::shared_ptr<PlacementArena>& getArena() const { return arena; }
+
+    private:
+        std::shared_ptr<PlacementArena> arena;
+    };
+
+    template <typename T, typename U>
+    bool operator==(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return a.getArena() == b.getArena(); }
+    template <typename T, typename U>
+    bool operator!=(const ArenaAllocator<T>& a, const ArenaAllocator<U>& b) { return !(a == b); }
+
+}
+
+#endif // PLACEMENTARENA_H
@@ -0,0 +1,59 @@
+// include/Parallel/SimulationThreadPool.h
+#ifndef SIMULATIONTHREADPOOL_H
+#define SIMULATIONTHREADPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Parallel/NumaTopology.h"
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Grupo fijo de hilos de simulación, opcionalmente fijados a CPU.
+     *
+     * Cada hilo es dueño de una partición; runOnAll ejecuta la misma tarea en
+     * todos ellos y actúa como barrera.
+     */
+    class SimulationThreadPool {
+    public:
+        SimulationThreadPool(std::size_t numThreads, bool pinThreads, const NumaTopology& topology);
+        ~SimulationThreadPool();
+
+        SimulationThreadPool(const SimulationThreadPool&) = delete;
+        SimulationThreadPool& operator=(const SimulationThreadPool&) = delete;
+
+        std::size_t size() const { return threads.size(); }
+
+        // Ejecuta task(worker) en cada hilo y espera a que terminen todos
+        void runOnAll(const std::function<void(std::size_t)>& task);
+
+        int getCpu(std::size_t worker) const { return cpus[worker]; }   // -1 si no está fijado
+        int getNode(std::size_t worker) const { return nodes[worker]; }
+
+    private:
+        void workerLoop(std::size_t worker, int cpu);
+
+        std::vector<std::thread> threads;
+        std::vector<int> cpus;
+        std::vector<int> nodes;
+
+        std::mutex mtx;
+        std::condition_variable startCv;
+        std::condition_variable doneCv;
+        const std::function<void(std::size_t)>* currentTask = nullptr;
+        std::uint64_t generation = 0;
+        std::size_t pending = 0;
+        std::size_t started = 0;
+        bool stopping = false;
+        std::exception_ptr firstError;
+    };
+
+}
+
+#endif // SIMULATIONTHREADPOOL_H
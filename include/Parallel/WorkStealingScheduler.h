@@ -0,0 +1,50 @@
+// include/Parallel/WorkStealingScheduler.h
+#ifndef WORKSTEALINGSCHEDULER_H
+#define WORKSTEALINGSCHEDULER_H
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Parallel/SimulationThreadPool.h"
+
+namespace BioNeuralNetwork {
+
+    /**
+     * @brief Reparto de trozos de trabajo con robo entre los hilos de simulación.
+     *
+     * Cada hilo recibe inicialmente un bloque contiguo de trozos; cuando vacía
+     * su cola roba los trozos más antiguos de las colas ajenas. Así el trabajo
+     * de una neurona hub, dividido en muchos trozos, se reparte entre todos.
+     */
+    class WorkStealingScheduler {
+    public:
+        explicit WorkStealingScheduler(SimulationThreadPool& pool);
+
+        // Ejecuta body(worker, chunk) para cada chunk en [0, numChunks)
+        void parallelFor(std::size_t numChunks,
+                         const std::function<void(std::size_t, std::size_t)>& body);
+
+        // Trozos ejecutados por un hilo distinto del que los recibió
+        std::size_t getStolenCount() const { return stolen.load(std::memory_order_relaxed); }
+
+    private:
+        struct alignas(64) WorkerQueue {
+            std::mutex mtx;
+            std::deque<std::size_t> chunks;
+        };
+
+        bool popLocal(std::size_t worker, std::size_t& chunk);
+        bool steal(std::size_t thief, std::size_t& chunk);
+
+        SimulationThreadPool& pool;
+        std::vector<std::unique_ptr<WorkerQueue>> queues;
+        std::atomic<std::size_t> stolen{0};
+    };
+
+}
+
+#endif // WORKSTEALINGSCHEDULER_H
@@ -5,7 +5,6 @@
 #include <memory>
 #include <cmath>
 #include <stdexcept>
-#include <sstream>
 
 #include "Core/ISynapse.h"
 #include "Core/INeuron.h"
@@ -30,10 +29,27 @@ namespace BioNeuralNetwork {
 
         void deliverSpikeFromPre(const std::shared_ptr<INeuron>& pre, double eventTime) override;
         void deliverSpikeFromPost(const std::shared_ptr<INeuron>& post, double eventTime) override;
+        void transmitFromPre(const std::shared_ptr<INeuron>& pre) override;
+        void applyPrePlasticity(const std::shared_ptr<INeuron>& pre, double eventTime) override;
 
         double getDelay() const override { return delay; }
+        double weightFloorSince(double now) override;
 
-        double getWeight() const { return weight; }
+        double getWeight() const override { return weight; }
+        void setWeight(double newWeight) override;
+
+        // Amplitudes de STDP (potenciación y depresión)
+        void setPotentiationAmplitude(double aPlus) { A_plus = aPlus; }
+        void setDepressionAmplitude(double aMinus) { A_minus = aMinus; }
+
+        std::shared_ptr<INeuron> getPreNeuron() const override { return pre_neuron; }
+        std::shared_ptr<INeuron> getPostNeuron() const override { return post_neuron; }
+
+        std::shared_ptr<ISynapse> cloneWithEndpoints(std::shared_ptr<INeuron> pre,
+                                                     std::shared_ptr<INeuron> post) const override;
+        std::shared_ptr<ISynapse> cloneWithEndpointsInto(std::shared_ptr<INeuron> pre,
+                                                         std::shared_ptr<INeuron> post,
+                                                         const std::shared_ptr<PlacementArena>& arena) const override;
 
     private:
         // Actualizar la firma para incluir eventTime
@@ -53,6 +69,7 @@ namespace BioNeuralNetwork {
         // Homeostasis
         double min_weight;
         double max_weight;
+        double floorSince;   // NaN mientras el peso esté por encima del mínimo
     };
 
 }
@@ -0,0 +1,13 @@
+// IConnectivityStrategy.cpp
+#include "ConnectivityStrategies/IConnectivityStrategy.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    void IConnectivityStrategy::connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) {
+        NetworkBuilder builder(neurons.size());
+        buildConnections(builder);
+        manager.addConnections(builder, neurons);
+    }
+
+}
@@ -1,23 +1,23 @@
 // RandomConnectivityStrategy.cpp
 #include "ConnectivityStrategies/RandomConnectivityStrategy.h"
-#include "Network/NetworkManager.h"
+#include <algorithm>
 #include <cmath>
 
 namespace BioNeuralNetwork {
 
-    void RandomConnectivityStrategy::connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) {
-        int numNeurons = static_cast<int>(neurons.size());
+    void RandomConnectivityStrategy::buildConnections(NetworkBuilder& builder) {
+        int numNeurons = static_cast<int>(builder.getNumNeurons());
+
+        // Número esperado de aristas, para no redimensionar el builder
+        const double expected = p_connection * numNeurons * std::max(0, numNeurons - 1);
+        builder.reserve(builder.size() + static_cast<std::size_t>(std::min(expected, 1e9) * 1.05));
 
         for (int i = 0; i < numNeurons; ++i) {
             for (int j = 0; j < numNeurons; ++j) {
                 if (i == j) continue; // Evitar auto-conexiones
                 double randProb = dist(gen);
                 if (randProb < p_connection) {
-                    if (isExcitatory) {
-                        manager.connectExcitatory(neurons[i], neurons[j], weight);
-                    } else {
-                        manager.connectInhibitory(neurons[i], neurons[j], weight);
-                    }
+                    builder.addEdge(i, j, weight, 1.0, isExcitatory);
                 }
             }
         }
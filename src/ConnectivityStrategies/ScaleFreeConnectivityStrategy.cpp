@@ -1,6 +1,5 @@
 // ScaleFreeConnectivityStrategy.cpp
 #include "ConnectivityStrategies/ScaleFreeConnectivityStrategy.h"
-#include "Network/NetworkManager.h"
 #include <algorithm>
 #include <stdexcept>
 #include <random>
@@ -19,18 +18,20 @@ int ScaleFreeConnectivityStrategy::selectPreferentially(const std::vector<int>&
     return static_cast<int>(degree.size() - 1);
 }
 
-void ScaleFreeConnectivityStrategy::connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) {
-    int numNeurons = static_cast<int>(neurons.size());
+void ScaleFreeConnectivityStrategy::buildConnections(NetworkBuilder& builder) {
+    int numNeurons = static_cast<int>(builder.getNumNeurons());
 
     if (m_initialNodes >= numNeurons) {
         throw std::invalid_argument("El número de nodos iniciales debe ser menor que el total de neuronas.");
     }
+    builder.reserve(builder.size() + static_cast<std::size_t>(m_initialNodes) * (m_initialNodes - 1) +
+                    2 * static_cast<std::size_t>(numNeurons - m_initialNodes) * m_connectionsPerNewNode);
 
     // Inicializar la red completa con los nodos iniciales
     for (int i = 0; i < m_initialNodes; ++i) {
         for (int j = i + 1; j < m_initialNodes; ++j) {
-            manager.connectExcitatory(neurons[i], neurons[j]);
-            manager.connectExcitatory(neurons[j], neurons[i]);
+            builder.addExcitatory(i, j);
+            builder.addExcitatory(j, i);
         }
     }
 
@@ -42,9 +43,7 @@ void ScaleFreeConnectivityStrategy::connectNeurons(std::vector<std::shared_ptr<I
     for (int i = m_initialNodes; i < numNeurons; ++i) {
         std::vector<int> possibleTargets;
         for (int j = 0; j < i; ++j) {
-            if (neurons[j] != neurons[i]) {
-                possibleTargets.push_back(j);
-            }
+            possibleTargets.push_back(j);
         }
 
         int connectionsMade = 0;
@@ -60,8 +59,8 @@ void ScaleFreeConnectivityStrategy::connectNeurons(std::vector<std::shared_ptr<I
             if (selected >= possibleTargets.size()) selected = static_cast<int>(possibleTargets.size() - 1);
 
             int target = possibleTargets[selected];
-            manager.connectExcitatory(neurons[i], neurons[target]);
-            manager.connectExcitatory(neurons[target], neurons[i]);
+            builder.addExcitatory(i, target);
+            builder.addExcitatory(target, i);
 
             degree[i]++;
             degree[target]++;
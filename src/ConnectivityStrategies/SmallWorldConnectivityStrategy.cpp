@@ -1,19 +1,19 @@
 // SmallWorldConnectivityStrategy.cpp
 #include "ConnectivityStrategies/SmallWorldConnectivityStrategy.h"
-#include "Network/NetworkManager.h"
 #include <cmath>
 #include <random>
 
 namespace BioNeuralNetwork {
 
-    void SmallWorldConnectivityStrategy::connectNeurons(std::vector<std::shared_ptr<INeuron>>& neurons, NetworkManager& manager) {
-        int numNeurons = static_cast<int>(neurons.size());
+    void SmallWorldConnectivityStrategy::buildConnections(NetworkBuilder& builder) {
+        int numNeurons = static_cast<int>(builder.getNumNeurons());
+        builder.reserve(builder.size() + static_cast<std::size_t>(numNeurons) * (k / 2) * 2);
 
         for (int i = 0; i < numNeurons; ++i) {
             for (int j = 1; j <= k / 2; ++j) {
                 int target = (i + j) % numNeurons;
-                manager.connectExcitatory(neurons[i], neurons[target]);
-                manager.connectExcitatory(neurons[target], neurons[i]);
+                builder.addExcitatoryIfAbsent(i, target);
+                builder.addExcitatoryIfAbsent(target, i);
             }
         }
 
@@ -26,7 +26,8 @@ namespace BioNeuralNetwork {
 
                     if (newTarget == i) continue;
 
-                    manager.connectExcitatory(neurons[i], neurons[newTarget]);
+                    // Un atajo hacia un vecino ya conectado no crea una sinapsis duplicada
+                    builder.addExcitatoryIfAbsent(i, newTarget);
                 }
             }
         }
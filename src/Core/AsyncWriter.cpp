@@ -0,0 +1,248 @@
+// src/Core/AsyncWriter.cpp
+#include "Core/AsyncWriter.h"
+#include <cstdio>
+#include <iomanip>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+AsyncWriter::AsyncWriter(const AsyncWriterConfig& config) : config(config) {
+    if (config.recordsPerBuffer == 0) {
+        throw std::invalid_argument("El tamaño de bloque del escritor debe ser positivo.");
+    }
+    if (config.maxPendingBuffers == 0 || config.maxPendingBuffers > kMaxPendingBuffers) {
+        throw std::invalid_argument("maxPendingBuffers debe estar entre 1 y " +
+                                    std::to_string(kMaxPendingBuffers) + ".");
+    }
+
+    if (!config.spikesFile.empty()) {
+        spikesOut.open(config.spikesFile);
+        if (!spikesOut.is_open()) {
+            throw std::runtime_error("No se pudo abrir el archivo para escribir spikes CSV.");
+        }
+        spikesOut << "NeuronID,Time(ms)\n";
+    }
+    if (!config.weightChangesFile.empty()) {
+        weightChangesOut.open(config.weightChangesFile);
+        if (!weightChangesOut.is_open()) {
+            throw std::runtime_error("No se pudo abrir el archivo para escribir cambios de peso CSV.");
+        }
+        weightChangesOut << "SynapseID,Time(ms),OldWeight,NewWeight\n";
+    }
+    if (!config.textLogFile.empty()) {
+        textOut.open(config.textLogFile);
+        textWeightChangesOut.open(config.textLogFile + ".tmp");
+        if (!textOut.is_open() || !textWeightChangesOut.is_open()) {
+            throw std::runtime_error("No se pudo abrir el archivo para escribir logs de texto.");
+        }
+        textOut << "=== LOGS DE SPIKES ===\n";
+    }
+
+    for (std::size_t b = 0; b <= config.maxPendingBuffers; ++b) {
+        pool.push_back(std::make_unique<RecordBuffer>());
+        pool.back()->spikes.reserve(config.recordsPerBuffer);
+    }
+    current = pool[0].get();
+    for (std::size_t b = 1; b < pool.size(); ++b) {
+        recycledQueue.tryPush(pool[b].get());
+    }
+
+    thread = std::thread([this] { run(); });
+}
+
+AsyncWriter::~AsyncWriter() {
+    try {
+        close();
+    } catch (const std::exception&) {
+        // Un destructor no debe lanzar: el error ya no puede notificarse
+    }
+}
+
+void AsyncWriter::writeSpike(const SpikeRecord& record) {
+    current->spikes.push_back(record);
+    sealIfFull();
+}
+
+void AsyncWriter::writeWeightChange(const WeightChangeRecord& record) {
+    current->weightChanges.push_back(record);
+    sealIfFull();
+}
+
+void AsyncWriter::sealIfFull() {
+    if (current->size() >= config.recordsPerBuffer) {
+        seal();
+    }
+}
+
+void AsyncWriter::seal() {
+    sealedQueue.tryPush(current);   // Nunca está llena: hay menos bloques que huecos
+    ++sealedBuffers;
+    wakeWriter();
+
+    // Contrapresión: sin bloques libres, el escritor lleva maxPendingBuffers de retraso
+    if (recycledQueue.empty()) {
+        ++stalls;
+    }
+    waitProducer([this] { return !recycledQueue.empty(); });
+    recycledQueue.tryPop(current);
+}
+
+void AsyncWriter::flush() {
+    if (!thread.joinable()) {
+        return;
+    }
+    if (current->size() > 0) {
+        seal();
+    }
+    waitProducer([this] { return writtenBuffers.load(std::memory_order_acquire) == sealedBuffers; });
+
+    if (failed.load(std::memory_order_acquire) && !errorReported) {
+        errorReported = true;
+        std::rethrow_exception(error);
+    }
+}
+
+void AsyncWriter::close() {
+    if (!thread.joinable()) {
+        return;
+    }
+    try {
+        flush();
+    } catch (...) {
+        stopping.store(true);
+        wakeWriter();
+        thread.join();
+        if (textOut.is_open()) {
+            textWeightChangesOut.close();
+            std::remove((config.textLogFile + ".tmp").c_str());
+        }
+        throw;
+    }
+    stopping.store(true);
+    wakeWriter();
+    thread.join();
+    finishTextLog();
+}
+
+void AsyncWriter::finishTextLog() {
+    if (!textOut.is_open()) {
+        return;
+    }
+    const std::string pending = config.textLogFile + ".tmp";
+    textWeightChangesOut.close();
+    textOut << "\n=== LOGS DE CAMBIOS DE PESO ===\n";
+    {
+        std::ifstream weightChanges(pending);
+        if (weightChanges.peek() != std::ifstream::traits_type::eof()) {
+            textOut << weightChanges.rdbuf();
+        }
+    }
+    std::remove(pending.c_str());
+    textOut.close();
+    if (!textOut) {
+        throw std::runtime_error("Error al escribir los registros en disco.");
+    }
+}
+
+// Los avisos combinan un indicador de espera con barreras seq_cst: o quien
+// espera ve el cambio al comprobar su condición, o quien avisa ve el indicador
+// y notifica bajo el mutex, de modo que no se pierde ningún aviso.
+template <typename Predicate>
+void AsyncWriter::waitProducer(Predicate ready) {
+    if (ready()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(parkMutex);
+    producerWaiting.store(true);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    producerWake.wait(lock, ready);
+    producerWaiting.store(false);
+}
+
+void AsyncWriter::wakeProducer() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (producerWaiting.load()) {
+        std::lock_guard<std::mutex> lock(parkMutex);
+        producerWake.notify_one();
+    }
+}
+
+void AsyncWriter::wakeWriter() {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (writerWaiting.load() || stopping.load()) {
+        std::lock_guard<std::mutex> lock(parkMutex);
+        writerWake.notify_one();
+    }
+}
+
+void AsyncWriter::run() {
+    for (;;) {
+        RecordBuffer* buffer = nullptr;
+        if (!sealedQueue.tryPop(buffer)) {
+            if (stopping.load()) {
+                return;
+            }
+            std::unique_lock<std::mutex> lock(parkMutex);
+            writerWaiting.store(true);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            writerWake.wait(lock, [this] { return !sealedQueue.empty() || stopping.load(); });
+            writerWaiting.store(false);
+            continue;
+        }
+
+        // Tras un error se siguen reciclando bloques para no bloquear al productor
+        if (!failed.load(std::memory_order_relaxed)) {
+            try {
+                encode(*buffer);
+                if (sealedQueue.empty()) {
+                    if (spikesOut.is_open()) spikesOut.flush();
+                    if (weightChangesOut.is_open()) weightChangesOut.flush();
+                    if (textOut.is_open()) textOut.flush();
+                }
+                if ((spikesOut.is_open() && !spikesOut) || (weightChangesOut.is_open() && !weightChangesOut) ||
+                    (textOut.is_open() && (!textOut || !textWeightChangesOut))) {
+                    throw std::runtime_error("Error al escribir los registros en disco.");
+                }
+            } catch (...) {
+                error = std::current_exception();
+                failed.store(true, std::memory_order_release);
+            }
+        }
+
+        buffer->clear();
+        recycledQueue.tryPush(buffer);
+        writtenBuffers.fetch_add(1, std::memory_order_release);
+        wakeProducer();
+    }
+}
+
+void AsyncWriter::encode(const RecordBuffer& buffer) {
+    if (spikesOut.is_open()) {
+        spikesOut << std::fixed << std::setprecision(3);
+        for (const auto& spike : buffer.spikes) {
+            spikesOut << spike.neuronID << "," << spike.time << "\n";
+        }
+    }
+    if (weightChangesOut.is_open()) {
+        weightChangesOut << std::fixed << std::setprecision(3);
+        for (const auto& change : buffer.weightChanges) {
+            weightChangesOut << change.synapseID << ","
+                             << change.time << ","
+                             << change.oldWeight << ","
+                             << change.newWeight << "\n";
+        }
+    }
+    if (textOut.is_open()) {
+        textOut << std::fixed << std::setprecision(3);
+        for (const auto& spike : buffer.spikes) {
+            textOut << "Neurona " << spike.neuronID << " disparó a " << spike.time << " ms\n";
+        }
+        textWeightChangesOut << std::fixed << std::setprecision(3);
+        for (const auto& change : buffer.weightChanges) {
+            textWeightChangesOut << "Sinapsis " << change.synapseID << ": Peso cambió de " << change.oldWeight
+                                 << " a " << change.newWeight << " en " << change.time << " ms\n";
+        }
+    }
+}
+
+}
@@ -0,0 +1,207 @@
+// src/Core/HardwareCounters.cpp
+#include "Core/HardwareCounters.h"
+#include <iomanip>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstring>
+#endif
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+#ifdef __linux__
+    struct CounterSpec {
+        HardwareCounter counter;
+        std::uint32_t type;
+        std::uint64_t config;
+    };
+
+    const CounterSpec kCounterSpecs[] = {
+        {HardwareCounter::Cycles,       PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {HardwareCounter::Instructions, PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {HardwareCounter::LLCMisses,    PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+        {HardwareCounter::BranchMisses, PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    };
+
+    int openCounter(const CounterSpec& spec, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = spec.type;
+        attr.config = spec.config;
+        attr.disabled = groupFd < 0 ? 1 : 0;
+        attr.exclude_kernel = 1; // Permitido con perf_event_paranoid <= 2
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // pid = 0, cpu = -1: solo el hilo llamante, en cualquier CPU
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+#endif
+
+}
+
+const char* toString(HardwareCounter counter) {
+    switch (counter) {
+        case HardwareCounter::Cycles:       return "cycles";
+        case HardwareCounter::Instructions: return "instructions";
+        case HardwareCounter::LLCMisses:    return "llc-misses";
+        case HardwareCounter::BranchMisses: return "branch-misses";
+        case HardwareCounter::Count:        break;
+    }
+    return "unknown";
+}
+
+PerfEventGroup::~PerfEventGroup() {
+    close();
+}
+
+void PerfEventGroup::close() {
+#ifdef __linux__
+    for (int fd : fds) {
+        ::close(fd);
+    }
+#endif
+    fds.clear();
+    leaderFd = -1;
+    memberIndex.fill(-1);
+}
+
+bool PerfEventGroup::open() {
+    close();
+#ifdef __linux__
+    for (const auto& spec : kCounterSpecs) {
+        int fd = openCounter(spec, leaderFd);
+        if (fd < 0) {
+            continue; // Contador no soportado o sin permisos: se omite
+        }
+        if (leaderFd < 0) {
+            leaderFd = fd;
+        }
+        memberIndex[static_cast<std::size_t>(spec.counter)] = static_cast<int>(fds.size());
+        fds.push_back(fd);
+    }
+    if (leaderFd < 0) {
+        return false;
+    }
+    ioctl(leaderFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(leaderFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool PerfEventGroup::read(HardwareCounterValues& values) const {
+#ifdef __linux__
+    if (leaderFd < 0) {
+        return false;
+    }
+    std::uint64_t buffer[3 + kNumHardwareCounters];
+    const ssize_t expected = static_cast<ssize_t>((3 + fds.size()) * sizeof(std::uint64_t));
+    if (::read(leaderFd, buffer, sizeof(buffer)) < expected) {
+        return false;
+    }
+    const std::uint64_t enabled = buffer[1];
+    const std::uint64_t running = buffer[2];
+    const double scale = (running > 0 && running < enabled) ? static_cast<double>(enabled) / running : 1.0;
+
+    values.fill(0);
+    for (std::size_t c = 0; c < kNumHardwareCounters; ++c) {
+        if (memberIndex[c] >= 0) {
+            values[c] = static_cast<std::uint64_t>(buffer[3 + memberIndex[c]] * scale);
+        }
+    }
+    return true;
+#else
+    (void)values;
+    return false;
+#endif
+}
+
+HardwareCounterProfiler::HardwareCounterProfiler(std::size_t numThreadSlots)
+    : slots(numThreadSlots == 0 ? 1 : numThreadSlots) {}
+
+bool HardwareCounterProfiler::probe() {
+    Slot& slot = slots[0];
+    slot.tried = true;
+    available = slot.group.open();
+    return available;
+}
+
+bool HardwareCounterProfiler::readSlot(std::size_t threadSlot, HardwareCounterValues& values) {
+    if (!available || threadSlot >= slots.size()) {
+        return false;
+    }
+    Slot& slot = slots[threadSlot];
+    if (!slot.tried) {
+        // Primera lectura desde este hilo: abrir su propio grupo
+        slot.tried = true;
+        slot.group.open();
+    }
+    return slot.group.read(values);
+}
+
+void HardwareCounterProfiler::accumulate(std::size_t threadSlot, SimulationPhase phase,
+                                         const HardwareCounterValues& begin, const HardwareCounterValues& end)
+{
+    auto& totals = slots[threadSlot].totals[static_cast<std::size_t>(phase)];
+    for (std::size_t c = 0; c < kNumHardwareCounters; ++c) {
+        if (end[c] >= begin[c]) {
+            totals[c] += end[c] - begin[c];
+        }
+    }
+}
+
+HardwareCounterValues HardwareCounterProfiler::getPhaseTotals(SimulationPhase phase) const {
+    HardwareCounterValues result{};
+    for (const auto& slot : slots) {
+        const auto& totals = slot.totals[static_cast<std::size_t>(phase)];
+        for (std::size_t c = 0; c < kNumHardwareCounters; ++c) {
+            result[c] += totals[c];
+        }
+    }
+    return result;
+}
+
+bool HardwareCounterProfiler::isSupported(HardwareCounter counter) const {
+    return available && slots[0].group.isSupported(counter);
+}
+
+void HardwareCounterProfiler::printReport(std::ostream& out) const {
+    if (!available) {
+        out << "Contadores de hardware no disponibles (perf_event_open no permitido).\n";
+        return;
+    }
+
+    const SimulationPhase phases[] = {SimulationPhase::Integration, SimulationPhase::SpikeEmission,
+                                      SimulationPhase::EventDelivery, SimulationPhase::Plasticity};
+    out << "Contadores de hardware por fase:\n";
+    for (SimulationPhase phase : phases) {
+        const auto totals = getPhaseTotals(phase);
+        out << " - " << std::left << std::setw(16) << toString(phase) << std::right;
+        for (std::size_t c = 0; c < kNumHardwareCounters; ++c) {
+            auto counter = static_cast<HardwareCounter>(c);
+            out << " " << toString(counter) << "=";
+            if (isSupported(counter)) {
+                out << totals[c];
+            } else {
+                out << "n/d";
+            }
+        }
+        const auto cycles = totals[static_cast<std::size_t>(HardwareCounter::Cycles)];
+        const auto instructions = totals[static_cast<std::size_t>(HardwareCounter::Instructions)];
+        if (cycles > 0 && instructions > 0) {
+            out << " IPC=" << std::fixed << std::setprecision(2)
+                << static_cast<double>(instructions) / static_cast<double>(cycles);
+            out.unsetf(std::ios::fixed);
+        }
+        out << "\n";
+    }
+}
+
+}
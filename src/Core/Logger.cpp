@@ -1,27 +1,152 @@
 // src/Core/Logger.cpp
 #include "Core/Logger.h"
+#include "Core/AsyncWriter.h"
 #include <stdexcept>
 #include <iostream>
+#include <thread>
 
 namespace BioNeuralNetwork {
 
+namespace {
+    // Cada sesión de streaming de cualquier Logger tiene un número distinto, de
+    // modo que la caché de un hilo nunca apunta a bloques de una sesión cerrada
+    std::atomic<std::uint64_t> nextStagingSession{1};
+}
+
+struct Logger::StagingBuffer {
+    std::thread::id owner;
+    std::vector<SpikeRecord> spikes;
+    std::vector<WeightChangeRecord> weightChanges;
+    // Totales de la sesión; el hilo dueño los escribe y getSpikeCount los lee
+    std::atomic<int> spikeCount{0};
+    std::atomic<int> weightChangeCount{0};
+
+    std::size_t size() const { return spikes.size() + weightChanges.size(); }
+};
+
+Logger::Logger() : realTimeLogging(false) {}
+
+Logger::~Logger() {
+    try {
+        stopStreaming();
+    } catch (const std::exception&) {
+        // Un destructor no debe lanzar: el error ya no puede notificarse
+    }
+}
+
+Logger::StagingBuffer* Logger::stagingBuffer() {
+    struct Cache {
+        std::uint64_t session = 0;
+        StagingBuffer* buffer = nullptr;
+    };
+    static thread_local Cache cache;
+
+    const std::uint64_t session = stagingSession.load(std::memory_order_acquire);
+    if (session == 0) {
+        return nullptr;
+    }
+    if (cache.session == session) {
+        return cache.buffer;
+    }
+
+    // Primer registro del hilo en esta sesión (o el hilo alterna entre Loggers)
+    std::lock_guard<std::mutex> lock(mtx);
+    if (stagingSession.load(std::memory_order_relaxed) != session) {
+        return nullptr;
+    }
+    const std::thread::id self = std::this_thread::get_id();
+    StagingBuffer* found = nullptr;
+    for (const auto &staging : stagingBuffers) {
+        if (staging->owner == self) {
+            found = staging.get();
+            break;
+        }
+    }
+    if (!found) {
+        stagingBuffers.push_back(std::make_unique<StagingBuffer>());
+        found = stagingBuffers.back().get();
+        found->owner = self;
+        found->spikes.reserve(kStagingRecords);
+    }
+    cache = Cache{session, found};
+    return found;
+}
+
+void Logger::handOff(StagingBuffer& staging) {
+    if (!writer) {
+        return;
+    }
+    for (const auto& spike : staging.spikes) {
+        writer->writeSpike(spike);
+    }
+    for (const auto& change : staging.weightChanges) {
+        writer->writeWeightChange(change);
+    }
+    staging.spikes.clear();
+    staging.weightChanges.clear();
+}
+
+void Logger::drainStaging() {
+    for (const auto &staging : stagingBuffers) {
+        handOff(*staging);
+    }
+}
+
 void Logger::logSpike(int neuronID, double time) {
+    if (!isSpikeRecording()) {
+        return;
+    }
+    if (StagingBuffer* staging = stagingBuffer()) {
+        staging->spikes.push_back(SpikeRecord{neuronID, time});
+        staging->spikeCount.store(staging->spikeCount.load(std::memory_order_relaxed) + 1,
+                                  std::memory_order_relaxed);
+        if (staging->size() >= kStagingRecords) {
+            std::lock_guard<std::mutex> lock(mtx);
+            handOff(*staging);
+        }
+        return;
+    }
     std::lock_guard<std::mutex> lock(mtx);
-    spikeRecords.emplace_back(SpikeRecord{neuronID, time});
+    if (writer) {
+        writer->writeSpike(SpikeRecord{neuronID, time});
+        ++streamedSpikes;
+    } else {
+        spikeRecords.emplace_back(SpikeRecord{neuronID, time});
+    }
     if (realTimeLogging) {
         std::cout << "[LOG] Neurona " << neuronID << " disparó a " << std::fixed << std::setprecision(3) << time << " ms\n";
     }
 }
 
 void Logger::logWeightChange(const std::string& synapseID, double time, double oldWeight, double newWeight) {
+    if (StagingBuffer* staging = stagingBuffer()) {
+        staging->weightChanges.push_back(WeightChangeRecord{synapseID, time, oldWeight, newWeight});
+        staging->weightChangeCount.store(staging->weightChangeCount.load(std::memory_order_relaxed) + 1,
+                                         std::memory_order_relaxed);
+        if (staging->size() >= kStagingRecords) {
+            std::lock_guard<std::mutex> lock(mtx);
+            handOff(*staging);
+        }
+        return;
+    }
     std::lock_guard<std::mutex> lock(mtx);
-    weightChangeRecords.emplace_back(WeightChangeRecord{synapseID, time, oldWeight, newWeight});
+    if (writer) {
+        writer->writeWeightChange(WeightChangeRecord{synapseID, time, oldWeight, newWeight});
+        ++streamedWeightChanges;
+    } else {
+        weightChangeRecords.emplace_back(WeightChangeRecord{synapseID, time, oldWeight, newWeight});
+    }
     if (realTimeLogging) {
         std::cout << "[LOG] Sinapsis " << synapseID << ": Peso cambió de " << std::fixed << std::setprecision(3) << oldWeight
                   << " a " << newWeight << " en " << time << " ms\n";
     }
 }
 
+void Logger::recordWeightChange(const WeightChangeEvent& change) {
+    logWeightChange(std::to_string(change.preID) + "_" + std::to_string(change.postID),
+                    change.time, change.oldWeight, change.newWeight);
+}
+
 void Logger::exportSpikesToCSV(const std::string& filename) {
     std::lock_guard<std::mutex> lock(mtx);
     std::ofstream file(filename);
@@ -86,17 +211,71 @@ void Logger::exportLogsToText(const std::string& filename) {
 
 int Logger::getSpikeCount() const {
     std::lock_guard<std::mutex> lock(mtx);
-    return spikeRecords.size();
+    int count = streamedSpikes + static_cast<int>(spikeRecords.size());
+    for (const auto &staging : stagingBuffers) {
+        count += staging->spikeCount.load(std::memory_order_relaxed);
+    }
+    return count;
 }
 
 int Logger::getWeightChangeCount() const {
     std::lock_guard<std::mutex> lock(mtx);
-    return weightChangeRecords.size();
+    int count = streamedWeightChanges + static_cast<int>(weightChangeRecords.size());
+    for (const auto &staging : stagingBuffers) {
+        count += staging->weightChangeCount.load(std::memory_order_relaxed);
+    }
+    return count;
 }
 
 void Logger::setRealTimeLogging(bool enable) {
     std::lock_guard<std::mutex> lock(mtx);
     realTimeLogging = enable;
+    // El registro en tiempo real imprime en orden: se vuelve a la entrega con el mutex
+    if (writer) {
+        stagingSession.store(enable ? 0 : nextStagingSession.fetch_add(1), std::memory_order_release);
+    }
+}
+
+void Logger::startStreaming(const AsyncWriterConfig& config) {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (writer) {
+        throw std::logic_error("El Logger ya está escribiendo en segundo plano.");
+    }
+    writer = std::make_unique<AsyncWriter>(config);
+    if (!realTimeLogging) {
+        stagingSession.store(nextStagingSession.fetch_add(1), std::memory_order_release);
+    }
+}
+
+void Logger::flushStreaming() {
+    std::lock_guard<std::mutex> lock(mtx);
+    if (writer) {
+        drainStaging();
+        writer->flush();
+    }
+}
+
+void Logger::stopStreaming() {
+    std::unique_ptr<AsyncWriter> finished;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        drainStaging();
+        for (const auto &staging : stagingBuffers) {
+            streamedSpikes += staging->spikeCount.load(std::memory_order_relaxed);
+            streamedWeightChanges += staging->weightChangeCount.load(std::memory_order_relaxed);
+        }
+        stagingBuffers.clear();
+        stagingSession.store(0, std::memory_order_release);
+        finished = std::move(writer);
+    }
+    if (finished) {
+        finished->close();
+    }
+}
+
+bool Logger::isStreaming() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return writer != nullptr;
 }
 
 }
@@ -0,0 +1,212 @@
+// src/Core/PopulationStatistics.cpp
+#include "Core/PopulationStatistics.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+namespace {
+    // Tolerancia para que t = k * binWidth calculado en coma flotante caiga en el bin k
+    long long binOf(double time, double binWidth) {
+        return static_cast<long long>(std::floor(time / binWidth + 1e-9));
+    }
+}
+
+PopulationStatistics::PopulationStatistics(std::size_t numNeurons,
+                                           const std::vector<std::size_t>& populationOfNeuron,
+                                           const PopulationStatisticsConfig& config,
+                                           double startTime)
+    : config(config), neurons(numNeurons)
+{
+    if (config.binWidth <= 0.0 || config.isiBinWidth <= 0.0) {
+        throw std::invalid_argument("Los anchos de bin deben ser positivos.");
+    }
+    if (config.historyBins == 0 || config.isiBins == 0) {
+        throw std::invalid_argument("El número de bins debe ser al menos 1.");
+    }
+    if (!populationOfNeuron.empty() && populationOfNeuron.size() != numNeurons) {
+        throw std::invalid_argument("La asignación de poblaciones no coincide con el número de neuronas.");
+    }
+
+    populationOf = populationOfNeuron.empty() ? std::vector<std::size_t>(numNeurons, 0) : populationOfNeuron;
+    std::size_t numPopulations = 1;
+    for (std::size_t p : populationOf) {
+        numPopulations = std::max(numPopulations, p + 1);
+    }
+
+    populations.resize(numPopulations);
+    for (auto& population : populations) {
+        population.history.assign(config.historyBins, 0);
+        population.isiHistogram.assign(config.isiBins, 0);
+    }
+    for (std::size_t p : populationOf) {
+        ++populations[p].size;
+    }
+    openBin = binOf(startTime, config.binWidth);
+}
+
+void PopulationStatistics::closeBinsBefore(long long bin) {
+    while (openBin < bin) {
+        const std::size_t slot = static_cast<std::size_t>(closedBins % static_cast<long long>(config.historyBins));
+        for (auto& population : populations) {
+            const double count = static_cast<double>(population.openCount);
+            population.closedSpikes += population.openCount;
+            population.sumCounts += count;
+            population.sumCountSquares += count * count;
+            population.sumNeuronSquares += population.openNeuronSquares;
+            population.history[slot] = static_cast<std::uint32_t>(population.openCount);
+            population.openCount = 0;
+            population.openNeuronSquares = 0.0;
+        }
+        ++openBin;
+        ++closedBins;
+    }
+}
+
+void PopulationStatistics::addNeuron(std::size_t population) {
+    // Los bins ya cerrados de una población nueva cuentan como vacíos
+    while (populations.size() <= population) {
+        PopulationState state;
+        state.history.assign(config.historyBins, 0);
+        state.isiHistogram.assign(config.isiBins, 0);
+        populations.push_back(std::move(state));
+    }
+    neurons.emplace_back();
+    populationOf.push_back(population);
+    ++populations[population].size;
+}
+
+void PopulationStatistics::recordSpike(std::size_t neuronIndex, double time) {
+    if (neuronIndex >= neurons.size()) {
+        throw std::out_of_range("Índice de neurona fuera de rango en PopulationStatistics.");
+    }
+    const long long bin = binOf(time, config.binWidth);
+    if (bin < openBin) {
+        throw std::invalid_argument("Los spikes deben llegar en orden temporal.");
+    }
+    closeBinsBefore(bin);
+
+    NeuronState& neuron = neurons[neuronIndex];
+    PopulationState& population = populations[populationOf[neuronIndex]];
+
+    if (neuron.bin != bin) {
+        neuron.bin = bin;
+        neuron.binCount = 0;
+    }
+    // (c + 1)² - c² = 2c + 1: suma de cuadrados por neurona sin recorrer la población
+    population.openNeuronSquares += 2.0 * neuron.binCount + 1.0;
+    ++neuron.binCount;
+    ++neuron.totalCount;
+    ++population.openCount;
+
+    if (neuron.lastSpikeTime >= 0.0) {
+        const double isi = time - neuron.lastSpikeTime;
+        const std::size_t isiBin = std::min(config.isiBins - 1,
+                                            static_cast<std::size_t>(isi / config.isiBinWidth));
+        ++population.isiHistogram[isiBin];
+
+        ++population.isiCount;
+        const double delta = isi - population.isiMean;
+        population.isiMean += delta / static_cast<double>(population.isiCount);
+        population.isiM2 += delta * (isi - population.isiMean);
+    }
+    neuron.lastSpikeTime = time;
+}
+
+void PopulationStatistics::advanceTo(double time) {
+    closeBinsBefore(binOf(time, config.binWidth));
+}
+
+std::size_t PopulationStatistics::getPopulationSize(std::size_t population) const {
+    return populations.at(population).size;
+}
+
+std::size_t PopulationStatistics::getPopulationOf(std::size_t neuronIndex) const {
+    return populationOf.at(neuronIndex);
+}
+
+double PopulationStatistics::getMeanRate(std::size_t population) const {
+    const PopulationState& state = populations.at(population);
+    if (closedBins == 0 || state.size == 0) {
+        return 0.0;
+    }
+    const double seconds = closedBins * config.binWidth / 1000.0;
+    return static_cast<double>(state.closedSpikes) / (state.size * seconds);
+}
+
+std::vector<double> PopulationStatistics::getRateHistory(std::size_t population) const {
+    const PopulationState& state = populations.at(population);
+    const long long capacity = static_cast<long long>(config.historyBins);
+    const long long available = std::min(closedBins, capacity);
+    const double scale = state.size > 0 ? 1000.0 / (state.size * config.binWidth) : 0.0;
+
+    std::vector<double> rates;
+    rates.reserve(static_cast<std::size_t>(available));
+    for (long long b = closedBins - available; b < closedBins; ++b) {
+        rates.push_back(state.history[static_cast<std::size_t>(b % capacity)] * scale);
+    }
+    return rates;
+}
+
+const std::vector<std::uint64_t>& PopulationStatistics::getIsiHistogram(std::size_t population) const {
+    return populations.at(population).isiHistogram;
+}
+
+double PopulationStatistics::getMeanIsi(std::size_t population) const {
+    return populations.at(population).isiMean;
+}
+
+double PopulationStatistics::getIsiCV(std::size_t population) const {
+    const PopulationState& state = populations.at(population);
+    if (state.isiCount < 2 || state.isiMean <= 0.0) {
+        return 0.0;
+    }
+    const double variance = state.isiM2 / static_cast<double>(state.isiCount - 1);
+    return std::sqrt(variance) / state.isiMean;
+}
+
+double PopulationStatistics::getFanoFactor(std::size_t population) const {
+    const PopulationState& state = populations.at(population);
+    if (closedBins == 0) {
+        return 0.0;
+    }
+    const double bins = static_cast<double>(closedBins);
+    const double mean = state.sumCounts / bins;
+    if (mean <= 0.0) {
+        return 0.0;
+    }
+    const double variance = state.sumCountSquares / bins - mean * mean;
+    return std::max(0.0, variance) / mean;
+}
+
+double PopulationStatistics::getSynchrony(std::size_t population) const {
+    const PopulationState& state = populations.at(population);
+    if (closedBins == 0 || state.size == 0) {
+        return 0.0;
+    }
+    const double bins = static_cast<double>(closedBins);
+
+    // Recuentos totales por neurona limitados a los bins cerrados (recorrido O(N) solo al consultar)
+    double sumTotalSquares = 0.0;
+    for (std::size_t i = 0; i < neurons.size(); ++i) {
+        if (populationOf[i] != population) {
+            continue;
+        }
+        const NeuronState& neuron = neurons[i];
+        const std::uint64_t open = neuron.bin == openBin ? neuron.binCount : 0;
+        const double closed = static_cast<double>(neuron.totalCount - open);
+        sumTotalSquares += closed * closed;
+    }
+
+    const double size = static_cast<double>(state.size);
+    const double meanActivity = state.sumCounts / (bins * size);
+    const double activityVariance = state.sumCountSquares / (bins * size * size) - meanActivity * meanActivity;
+    const double individualVariance = (state.sumNeuronSquares / bins - sumTotalSquares / (bins * bins)) / size;
+    if (individualVariance <= 0.0) {
+        return 0.0;
+    }
+    return std::max(0.0, activityVariance) / individualVariance;
+}
+
+}
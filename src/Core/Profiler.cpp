@@ -0,0 +1,105 @@
+// src/Core/Profiler.cpp
+#include "Core/Profiler.h"
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+const char* toString(SimulationPhase phase) {
+    switch (phase) {
+        case SimulationPhase::CurrentInjection: return "CurrentInjection";
+        case SimulationPhase::Integration:      return "Integration";
+        case SimulationPhase::SpikeEmission:    return "SpikeEmission";
+        case SimulationPhase::EventDelivery:    return "EventDelivery";
+        case SimulationPhase::Plasticity:       return "Plasticity";
+        case SimulationPhase::LoggerIO:         return "LoggerIO";
+        case SimulationPhase::Count:            break;
+    }
+    return "Unknown";
+}
+
+Profiler::Profiler()
+    : epoch(Clock::now()), slots(1) {}
+
+void Profiler::configure(std::size_t numThreadSlots) {
+    slots.assign(numThreadSlots == 0 ? 1 : numThreadSlots, ThreadSlot{});
+    epoch = Clock::now();
+}
+
+void Profiler::reset() {
+    configure(slots.size());
+}
+
+void Profiler::record(std::size_t threadSlot, SimulationPhase phase, long long tick,
+                      Clock::time_point begin, Clock::time_point end)
+{
+    if (threadSlot >= slots.size()) {
+        return;
+    }
+    ThreadSlot& slot = slots[threadSlot];
+    const double seconds = std::chrono::duration<double>(end - begin).count();
+    slot.seconds[static_cast<std::size_t>(phase)] += seconds;
+
+    if (tick >= traceFirstTick && tick <= traceLastTick) {
+        const double start = std::chrono::duration<double, std::micro>(begin - epoch).count();
+        slot.trace.push_back(TraceEvent{phase, tick, start, seconds * 1e6});
+    }
+}
+
+double Profiler::getPhaseSeconds(SimulationPhase phase) const {
+    double total = 0.0;
+    for (std::size_t t = 0; t < slots.size(); ++t) {
+        total += getPhaseSeconds(phase, t);
+    }
+    return total;
+}
+
+double Profiler::getPhaseSeconds(SimulationPhase phase, std::size_t threadSlot) const {
+    if (threadSlot >= slots.size() || phase == SimulationPhase::Count) {
+        return 0.0;
+    }
+    return slots[threadSlot].seconds[static_cast<std::size_t>(phase)];
+}
+
+void Profiler::setTraceWindow(long long firstTick, long long lastTick) {
+    traceFirstTick = firstTick;
+    traceLastTick = lastTick;
+}
+
+std::size_t Profiler::getTraceEventCount() const {
+    std::size_t count = 0;
+    for (const auto& slot : slots) {
+        count += slot.trace.size();
+    }
+    return count;
+}
+
+void Profiler::exportChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo para escribir la traza.");
+    }
+
+    file << "{\"traceEvents\":[\n";
+    bool first = true;
+    for (std::size_t t = 0; t < slots.size(); ++t) {
+        // Metadatos: nombre legible de cada hilo
+        file << (first ? "" : ",\n")
+             << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":" << t
+             << ",\"args\":{\"name\":\"" << (t == 0 ? std::string("main") : "worker " + std::to_string(t - 1))
+             << "\"}}";
+        first = false;
+
+        for (const auto& e : slots[t].trace) {
+            file << ",\n{\"name\":\"" << toString(e.phase) << "\",\"cat\":\"phase\",\"ph\":\"X\""
+                 << ",\"ts\":" << std::fixed << std::setprecision(3) << e.startMicros
+                 << ",\"dur\":" << e.durationMicros
+                 << ",\"pid\":0,\"tid\":" << t
+                 << ",\"args\":{\"tick\":" << e.tick << "}}";
+        }
+    }
+    file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+}
+
+}
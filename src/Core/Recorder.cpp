@@ -0,0 +1,92 @@
+// src/Core/Recorder.cpp
+#include "Core/Recorder.h"
+#include <cstdint>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+    template <typename T>
+    void writeField(std::ofstream& out, T value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    template <typename T>
+    bool readField(std::ifstream& in, T& value) {
+        return static_cast<bool>(in.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+
+}
+
+BinaryFileRecorder::BinaryFileRecorder(const std::string& filename)
+    : out(filename, std::ios::binary | std::ios::trunc)
+{
+    if (!out.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo de registro binario: " + filename);
+    }
+}
+
+void BinaryFileRecorder::recordSpike(int neuronID, double time) {
+    std::lock_guard<std::mutex> lock(mtx);
+    writeField(out, 'S');
+    writeField(out, static_cast<std::int32_t>(neuronID));
+    writeField(out, time);
+}
+
+void BinaryFileRecorder::recordWeightChange(const WeightChangeEvent& change) {
+    std::lock_guard<std::mutex> lock(mtx);
+    writeField(out, 'W');
+    writeField(out, static_cast<std::int32_t>(change.preID));
+    writeField(out, static_cast<std::int32_t>(change.postID));
+    writeField(out, change.time);
+    writeField(out, change.oldWeight);
+    writeField(out, change.newWeight);
+}
+
+void BinaryFileRecorder::flush() {
+    std::lock_guard<std::mutex> lock(mtx);
+    out.flush();
+    if (!out) {
+        throw std::runtime_error("Error al escribir el registro binario.");
+    }
+}
+
+BinaryRecords readBinaryRecords(const std::string& filename) {
+    std::ifstream in(filename, std::ios::binary);
+    if (!in.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo de registro binario: " + filename);
+    }
+
+    BinaryRecords records;
+    char type = 0;
+    while (readField(in, type)) {
+        std::int32_t id = 0;
+        std::int32_t post = 0;
+        WeightChangeEvent change{};
+        bool complete = false;
+        if (type == 'S') {
+            double time = 0.0;
+            complete = readField(in, id) && readField(in, time);
+            if (complete) {
+                records.spikes.emplace_back(id, time);
+            }
+        } else if (type == 'W') {
+            complete = readField(in, id) && readField(in, post) && readField(in, change.time) &&
+                       readField(in, change.oldWeight) && readField(in, change.newWeight);
+            if (complete) {
+                change.preID = id;
+                change.postID = post;
+                records.weightChanges.push_back(change);
+            }
+        } else {
+            throw std::runtime_error("Tipo de registro binario desconocido.");
+        }
+        if (!complete) {
+            throw std::runtime_error("Registro binario truncado.");
+        }
+    }
+    return records;
+}
+
+}
@@ -0,0 +1,129 @@
+// src/Core/SharedMemoryChannel.cpp
+#include "Core/SharedMemoryChannel.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace BioNeuralNetwork {
+
+namespace {
+    constexpr std::uint32_t kChannelMagic = 0x424E4E43; // "BNNC"
+}
+
+struct SharedMemoryChannel::Layout {
+    std::uint32_t magic;
+    alignas(64) std::atomic<std::int64_t> lastCompletedTick;
+    StimulusRing stimulusRing;
+    SpikeRing spikeRing;
+};
+
+SharedMemoryChannel SharedMemoryChannel::create(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("No se pudo crear la memoria compartida " + name + ": " + std::strerror(errno));
+    }
+    if (ftruncate(fd, sizeof(Layout)) != 0) {
+        close(fd);
+        shm_unlink(name.c_str());
+        throw std::runtime_error("No se pudo dimensionar la memoria compartida " + name + ".");
+    }
+    void* addr = mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        shm_unlink(name.c_str());
+        throw std::runtime_error("No se pudo mapear la memoria compartida " + name + ".");
+    }
+
+    Layout* layout = new (addr) Layout();
+    layout->lastCompletedTick.store(-1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    layout->magic = kChannelMagic;
+    return SharedMemoryChannel(name, layout, true);
+}
+
+SharedMemoryChannel SharedMemoryChannel::open(const std::string& name) {
+    int fd = shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        throw std::runtime_error("No se pudo abrir la memoria compartida " + name + ": " + std::strerror(errno));
+    }
+    // Un segmento más corto que el canal (ajeno, de otra versión o aún sin
+    // dimensionar) daría SIGBUS al leerlo: se rechaza antes de mapearlo
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size != static_cast<off_t>(sizeof(Layout))) {
+        close(fd);
+        throw std::runtime_error("El segmento " + name + " no tiene el tamaño de un canal de simulación.");
+    }
+    void* addr = mmap(nullptr, sizeof(Layout), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+        throw std::runtime_error("No se pudo mapear la memoria compartida " + name + ".");
+    }
+
+    Layout* layout = static_cast<Layout*>(addr);
+    if (layout->magic != kChannelMagic) {
+        munmap(addr, sizeof(Layout));
+        throw std::runtime_error("El segmento " + name + " no es un canal de simulación válido.");
+    }
+    return SharedMemoryChannel(name, layout, false);
+}
+
+SharedMemoryChannel::SharedMemoryChannel(const std::string& name, Layout* layout, bool owner)
+    : name(name), layout(layout), owner(owner) {}
+
+SharedMemoryChannel::SharedMemoryChannel(SharedMemoryChannel&& other) noexcept
+    : name(std::move(other.name)), layout(other.layout), owner(other.owner)
+{
+    other.layout = nullptr;
+    other.owner = false;
+}
+
+SharedMemoryChannel& SharedMemoryChannel::operator=(SharedMemoryChannel&& other) noexcept {
+    if (this != &other) {
+        release();
+        name = std::move(other.name);
+        layout = other.layout;
+        owner = other.owner;
+        other.layout = nullptr;
+        other.owner = false;
+    }
+    return *this;
+}
+
+SharedMemoryChannel::~SharedMemoryChannel() {
+    release();
+}
+
+void SharedMemoryChannel::release() {
+    if (layout) {
+        munmap(layout, sizeof(Layout));
+        layout = nullptr;
+    }
+    if (owner) {
+        shm_unlink(name.c_str());
+        owner = false;
+    }
+}
+
+SharedMemoryChannel::StimulusRing& SharedMemoryChannel::stimulus() {
+    return layout->stimulusRing;
+}
+
+SharedMemoryChannel::SpikeRing& SharedMemoryChannel::spikes() {
+    return layout->spikeRing;
+}
+
+void SharedMemoryChannel::publishCompletedTick(std::int64_t tick) {
+    layout->lastCompletedTick.store(tick, std::memory_order_release);
+}
+
+std::int64_t SharedMemoryChannel::completedTick() const {
+    return layout->lastCompletedTick.load(std::memory_order_acquire);
+}
+
+}
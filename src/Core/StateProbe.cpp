@@ -0,0 +1,216 @@
+// src/Core/StateProbe.cpp
+#include "Core/StateProbe.h"
+#include "Core/INeuron.h"
+#include "Core/ISynapse.h"
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+namespace {
+    constexpr char kMagic[8] = {'B', 'N', 'N', 'P', 'R', 'O', 'B', 'E'};
+    constexpr std::uint32_t kVersion = 1;
+
+    template <typename T>
+    void writeValue(std::FILE* file, const T& value) {
+        if (std::fwrite(&value, sizeof(T), 1, file) != 1) {
+            throw std::runtime_error("Error al escribir el fichero de la sonda.");
+        }
+    }
+
+    template <typename T>
+    void writeArray(std::FILE* file, const T* data, std::size_t count) {
+        if (count > 0 && std::fwrite(data, sizeof(T), count, file) != count) {
+            throw std::runtime_error("Error al escribir el fichero de la sonda.");
+        }
+    }
+
+    template <typename T>
+    bool readArray(std::FILE* file, T* data, std::size_t count) {
+        return count == 0 || std::fread(data, sizeof(T), count, file) == count;
+    }
+}
+
+std::size_t ProbeRecording::getNumTargets() const {
+    return variable == ProbeVariable::SynapticWeight ? targets.size() / 2 : targets.size();
+}
+
+double ProbeRecording::at(std::size_t sample, std::size_t target) const {
+    const std::size_t n = getNumTargets();
+    if (sample >= ticks.size() || target >= n) {
+        throw std::out_of_range("Muestra u objetivo fuera de rango en ProbeRecording::at.");
+    }
+    return values[sample * n + target];
+}
+
+StateProbe::StateProbe(const ProbeConfig& config, double timeStep, long long startTick)
+    : config(config),
+      numTargets(config.variable == ProbeVariable::SynapticWeight ? config.synapses.size() : config.neurons.size()),
+      nextTick(startTick)
+{
+    if (numTargets == 0) {
+        throw std::invalid_argument("La sonda necesita al menos un objetivo.");
+    }
+    if (config.samplingInterval <= 0 || config.bufferSamples == 0) {
+        throw std::invalid_argument("El intervalo de muestreo y el tamaño del bloque deben ser positivos.");
+    }
+
+    ticks.resize(config.bufferSamples);
+    values.resize(config.bufferSamples * numTargets);
+
+    if (!config.filename.empty()) {
+        file = std::fopen(config.filename.c_str(), "wb");
+        if (!file) {
+            throw std::runtime_error("No se pudo abrir el fichero de la sonda: " + config.filename);
+        }
+        writeHeader(timeStep);
+    }
+}
+
+StateProbe::~StateProbe() {
+    if (file) {
+        try {
+            flush();
+        } catch (const std::exception&) {
+            // Un destructor no debe lanzar: lo pendiente se pierde
+        }
+        std::fclose(file);
+    }
+}
+
+void StateProbe::writeHeader(double timeStep) {
+    writeArray(file, kMagic, sizeof(kMagic));
+    writeValue(file, kVersion);
+    writeValue(file, static_cast<std::uint32_t>(config.variable));
+    writeValue(file, static_cast<std::uint64_t>(numTargets));
+    writeValue(file, timeStep);
+    writeValue(file, static_cast<std::int64_t>(config.samplingInterval));
+    if (config.variable == ProbeVariable::SynapticWeight) {
+        for (const auto& target : config.synapses) {
+            writeValue(file, static_cast<std::uint64_t>(target.first));
+            writeValue(file, static_cast<std::uint64_t>(target.second));
+        }
+    } else {
+        for (std::size_t target : config.neurons) {
+            writeValue(file, static_cast<std::uint64_t>(target));
+        }
+    }
+}
+
+void StateProbe::bindNeurons(std::vector<const INeuron*> targets) {
+    if (targets.size() != numTargets) {
+        throw std::invalid_argument("Número de neuronas distinto del de la sonda.");
+    }
+    boundNeurons = std::move(targets);
+}
+
+void StateProbe::remapTargets(const std::vector<std::size_t>& newIndexOf) {
+    for (std::size_t &target : config.neurons) {
+        target = newIndexOf.at(target);
+    }
+    for (auto &target : config.synapses) {
+        target = {newIndexOf.at(target.first), newIndexOf.at(target.second)};
+    }
+}
+
+void StateProbe::bindSynapses(std::vector<const ISynapse*> targets) {
+    if (targets.size() != numTargets) {
+        throw std::invalid_argument("Número de sinapsis distinto del de la sonda.");
+    }
+    boundSynapses = std::move(targets);
+}
+
+void StateProbe::sample(long long tick) {
+    if (tick < nextTick) {
+        return;
+    }
+    nextTick = tick + config.samplingInterval;
+
+    if (buffered == config.bufferSamples) {
+        if (!file) {
+            ++droppedSamples;
+            return;
+        }
+        flush();
+    }
+
+    ticks[buffered] = tick;
+    double* row = &values[buffered * numTargets];
+    switch (config.variable) {
+        case ProbeVariable::MembranePotential:
+            for (std::size_t k = 0; k < numTargets; ++k) {
+                row[k] = boundNeurons[k]->getMembranePotential();
+            }
+            break;
+        case ProbeVariable::Recovery:
+            for (std::size_t k = 0; k < numTargets; ++k) {
+                row[k] = boundNeurons[k]->getRecovery();
+            }
+            break;
+        case ProbeVariable::SynapticWeight:
+            for (std::size_t k = 0; k < numTargets; ++k) {
+                row[k] = boundSynapses[k] ? boundSynapses[k]->getWeight()
+                                          : std::numeric_limits<double>::quiet_NaN();
+            }
+            break;
+    }
+    ++buffered;
+    ++totalSamples;
+}
+
+void StateProbe::flush() {
+    if (!file || buffered == 0) {
+        return;
+    }
+    writeValue(file, static_cast<std::uint64_t>(buffered));
+    static_assert(sizeof(long long) == sizeof(std::int64_t), "Se esperan pasos de 64 bits");
+    writeArray(file, ticks.data(), buffered);
+    writeArray(file, values.data(), buffered * numTargets);
+    std::fflush(file);
+    buffered = 0;
+}
+
+ProbeRecording StateProbe::readFile(const std::string& filename) {
+    std::FILE* in = std::fopen(filename.c_str(), "rb");
+    if (!in) {
+        throw std::runtime_error("No se pudo abrir el fichero de la sonda: " + filename);
+    }
+
+    ProbeRecording recording;
+    char magic[sizeof(kMagic)];
+    std::uint32_t version = 0;
+    std::uint32_t variable = 0;
+    std::uint64_t numTargets = 0;
+    std::int64_t interval = 0;
+    bool ok = readArray(in, magic, sizeof(magic)) && std::memcmp(magic, kMagic, sizeof(kMagic)) == 0 &&
+              readArray(in, &version, 1) && version == kVersion &&
+              readArray(in, &variable, 1) &&
+              readArray(in, &numTargets, 1) &&
+              readArray(in, &recording.timeStep, 1) &&
+              readArray(in, &interval, 1);
+    if (ok) {
+        recording.variable = static_cast<ProbeVariable>(variable);
+        recording.samplingInterval = interval;
+        const std::size_t ids = recording.variable == ProbeVariable::SynapticWeight ? 2 * numTargets : numTargets;
+        recording.targets.resize(ids);
+        ok = readArray(in, recording.targets.data(), ids);
+    }
+
+    std::uint64_t count = 0;
+    while (ok && std::fread(&count, sizeof(count), 1, in) == 1) {
+        const std::size_t tickOffset = recording.ticks.size();
+        const std::size_t valueOffset = recording.values.size();
+        recording.ticks.resize(tickOffset + count);
+        recording.values.resize(valueOffset + count * numTargets);
+        ok = readArray(in, recording.ticks.data() + tickOffset, count) &&
+             readArray(in, recording.values.data() + valueOffset, count * numTargets);
+    }
+    std::fclose(in);
+    if (!ok) {
+        throw std::runtime_error("Fichero de sonda no válido o truncado: " + filename);
+    }
+    return recording;
+}
+
+}
@@ -0,0 +1,47 @@
+// src/Network/ClosedLoopSession.cpp
+#include "Network/ClosedLoopSession.h"
+#include "Network/NetworkManager.h"
+#include <algorithm>
+
+namespace BioNeuralNetwork {
+
+ClosedLoopSession::ClosedLoopSession(NetworkManager& manager, SharedMemoryChannel& channel)
+    : manager(manager), channel(channel) {}
+
+void ClosedLoopSession::drainStimulus(long long tick) {
+    StimulusMessage msg;
+    while (channel.stimulus().tryPop(msg)) {
+        pending.push_back(msg);
+    }
+
+    const std::size_t numNeurons = manager.getNeurons().size();
+    auto due = std::remove_if(pending.begin(), pending.end(), [&](const StimulusMessage& m) {
+        if (m.tick > tick) {
+            return false;
+        }
+        // Los estímulos con índice inválido se descartan silenciosamente
+        if (m.neuronIndex >= 0 && static_cast<std::size_t>(m.neuronIndex) < numNeurons) {
+            manager.injectExternalCurrent(static_cast<std::size_t>(m.neuronIndex), m.current);
+        }
+        return true;
+    });
+    pending.erase(due, pending.end());
+}
+
+void ClosedLoopSession::run(long long untilTick) {
+    while (manager.getCurrentTick() < untilTick) {
+        const long long tick = manager.getCurrentTick();
+        drainStimulus(tick);
+        manager.advance(tick + 1);
+
+        for (const auto& spike : manager.getRecentSpikes()) {
+            SpikeMessage msg{spike.tick, static_cast<std::int32_t>(spike.neuronIndex), 0};
+            if (!channel.spikes().tryPush(msg)) {
+                ++droppedSpikes;
+            }
+        }
+        channel.publishCompletedTick(tick);
+    }
+}
+
+}
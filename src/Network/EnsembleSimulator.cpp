@@ -0,0 +1,241 @@
+// src/Network/EnsembleSimulator.cpp
+#include "Network/EnsembleSimulator.h"
+#include "Neurons/IzhikevichNeuron.h"
+#include "Synapses/ExcitatorySynapse.h"
+#include "Synapses/InhibitorySynapse.h"
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace BioNeuralNetwork {
+
+EnsembleSimulator::EnsembleSimulator(const NetworkManager& network, const EnsembleConfig& config)
+    : config(config),
+      numInstances(config.numInstances),
+      numNeurons(network.getNeurons().size())
+{
+    if (numInstances == 0) {
+        throw std::invalid_argument("El conjunto debe tener al menos una instancia.");
+    }
+    if (config.timeStep <= 0.0) {
+        throw std::invalid_argument("El paso de tiempo debe ser positivo.");
+    }
+    if (!config.seeds.empty() && config.seeds.size() != numInstances) {
+        throw std::invalid_argument("Debe haber una semilla por instancia.");
+    }
+    if (network.getSynapticModel().dynamics != SynapseDynamics::Instantaneous) {
+        throw std::invalid_argument("El modo conjunto solo admite sinapsis instantáneas.");
+    }
+
+    const auto& neurons = network.getNeurons();
+    std::unordered_map<const INeuron*, std::size_t> indexOf;
+    indexOf.reserve(numNeurons);
+    parameters.reserve(numNeurons);
+    for (std::size_t n = 0; n < numNeurons; ++n) {
+        auto izhikevich = std::dynamic_pointer_cast<IzhikevichNeuron>(neurons[n]);
+        if (!izhikevich) {
+            throw std::invalid_argument("El modo conjunto solo admite neuronas de Izhikevich.");
+        }
+        parameters.push_back(izhikevich->getParameters());
+        indexOf[neurons[n].get()] = n;
+    }
+
+    // Conectividad CSR en el orden de las listas salientes
+    offsets.assign(numNeurons + 1, 0);
+    std::uint32_t maxDelay = 0;
+    for (std::size_t n = 0; n < numNeurons; ++n) {
+        const auto& outgoing = neurons[n]->getOutgoingSynapses();
+        offsets[n + 1] = offsets[n] + outgoing.size();
+        for (const auto& synapse : outgoing) {
+            double weight;
+            if (auto excitatory = std::dynamic_pointer_cast<ExcitatorySynapse>(synapse)) {
+                weight = excitatory->getWeight();
+            } else if (auto inhibitory = std::dynamic_pointer_cast<InhibitorySynapse>(synapse)) {
+                weight = -inhibitory->getWeight();
+            } else {
+                throw std::invalid_argument("Tipo de sinapsis no admitido en el modo conjunto.");
+            }
+            auto post = indexOf.find(synapse->getPostNeuron().get());
+            if (post == indexOf.end()) {
+                throw std::invalid_argument("Sinapsis hacia una neurona que no pertenece a la red.");
+            }
+            const auto delay = static_cast<std::uint32_t>(
+                std::max(0.0, std::ceil(synapse->getDelay() / config.timeStep - 1e-9)));
+            targets.push_back(static_cast<std::uint32_t>(post->second));
+            weights.push_back(weight);
+            delaySteps.push_back(delay);
+            maxDelay = std::max(maxDelay, delay);
+        }
+    }
+
+    // El evento con retardo d se entrega al final del paso t + d y actúa en el siguiente
+    numSlots = static_cast<std::size_t>(maxDelay) + 2;
+
+    const std::size_t stateSize = numNeurons * numInstances;
+    V.resize(stateSize);
+    u.resize(stateSize);
+    timeSinceLastSpike.resize(stateSize);
+    for (std::size_t n = 0; n < numNeurons; ++n) {
+        for (std::size_t k = 0; k < numInstances; ++k) {
+            V[stateIndex(k, n)] = neurons[n]->getMembranePotential();
+            u[stateIndex(k, n)] = neurons[n]->getRecovery();
+            timeSinceLastSpike[stateIndex(k, n)] = parameters[n].refractoryPeriod;
+        }
+    }
+    externalCurrents.assign(stateSize, 0.0);
+    input.assign(stateSize, 0.0);
+    fired.assign(stateSize, 0.0);
+    delayRing.assign(numSlots * stateSize, 0.0);
+
+    generators.reserve(numInstances);
+    for (std::size_t k = 0; k < numInstances; ++k) {
+        generators.emplace_back(config.seeds.empty() ? config.baseSeed + k : config.seeds[k]);
+    }
+    spikeCounts.assign(numInstances, 0);
+    spikes.resize(numInstances);
+}
+
+std::size_t EnsembleSimulator::stateIndex(std::size_t instance, std::size_t neuronIndex) const {
+    return neuronIndex * numInstances + instance;
+}
+
+void EnsembleSimulator::injectExternalCurrent(std::size_t instance, std::size_t neuronIndex, double current) {
+    if (instance >= numInstances || neuronIndex >= numNeurons) {
+        throw std::out_of_range("Instancia o neurona fuera de rango en injectExternalCurrent.");
+    }
+    externalCurrents[stateIndex(instance, neuronIndex)] += current;
+}
+
+double EnsembleSimulator::getPotential(std::size_t instance, std::size_t neuronIndex) const {
+    if (instance >= numInstances || neuronIndex >= numNeurons) {
+        throw std::out_of_range("Instancia o neurona fuera de rango en getPotential.");
+    }
+    return V[stateIndex(instance, neuronIndex)];
+}
+
+std::uint64_t EnsembleSimulator::getSpikeCount(std::size_t instance) const {
+    return spikeCounts.at(instance);
+}
+
+const std::vector<EmittedSpike>& EnsembleSimulator::getSpikes(std::size_t instance) const {
+    return spikes.at(instance);
+}
+
+void EnsembleSimulator::advance(long long untilTick) {
+    while (currentTick < untilTick) {
+        gatherInput();
+        integrate();
+        recordAndDeliver();
+        ++currentTick;
+    }
+}
+
+void EnsembleSimulator::gatherInput() {
+    const std::size_t stateSize = input.size();
+    double* ring = &delayRing[static_cast<std::size_t>(currentTick % static_cast<long long>(numSlots)) * stateSize];
+    const double background = config.backgroundCurrent;
+
+    // Mismo orden de suma que NetworkManager: corriente sináptica + (fondo + externa)
+    for (std::size_t i = 0; i < stateSize; ++i) {
+        input[i] = ring[i] + (background + externalCurrents[i]);
+        ring[i] = 0.0;
+        externalCurrents[i] = 0.0;
+    }
+
+    if (config.noiseStd > 0.0) {
+        // Cada instancia consume su generador en orden de neurona: sus resultados
+        // no dependen de cuántas instancias haya en el conjunto
+        std::normal_distribution<double> noise(0.0, config.noiseStd);
+        for (std::size_t k = 0; k < numInstances; ++k) {
+            for (std::size_t n = 0; n < numNeurons; ++n) {
+                input[stateIndex(k, n)] += noise(generators[k]);
+            }
+        }
+    }
+}
+
+void EnsembleSimulator::integrate() {
+    // Misma subdivisión que IzhikevichNeuron::stepSimulation
+    const double dt = config.timeStep;
+    const int nSteps = static_cast<int>(std::ceil(dt / IzhikevichNeuron::kDefaultSubstep));
+    const double h = dt / nSteps;
+    const std::size_t K = numInstances;
+
+    for (std::size_t n = 0; n < numNeurons; ++n) {
+        const IzhikevichParameters p = parameters[n];
+        double* v = &V[n * K];
+        double* w = &u[n * K];
+        double* ts = &timeSinceLastSpike[n * K];
+        double* f = &fired[n * K];
+        const double* in = &input[n * K];
+
+        std::fill(f, f + K, 0.0);
+        for (int s = 0; s < nSteps; ++s) {
+            // Sin ramas: el bucle sobre instancias se vectoriza
+            for (std::size_t k = 0; k < K; ++k) {
+                const double vk = v[k];
+                const double uk = w[k];
+                const double t = ts[k] + h;
+                const double vNew = vk + (0.04 * vk * vk + 5.0 * vk + 140.0 - uk + p.R * in[k]) * h;
+                const double uNew = uk + p.a * (p.b * vNew - uk) * h;
+                const bool active = t >= p.refractoryPeriod;
+                const bool spike = active && vNew >= p.V_threshold;
+                v[k] = spike ? p.V_reset : (active ? vNew : vk);
+                w[k] = spike ? uNew + p.d : (active ? uNew : uk);
+                ts[k] = spike ? 0.0 : t;
+                f[k] = spike ? 1.0 : f[k];
+            }
+        }
+    }
+}
+
+void EnsembleSimulator::recordAndDeliver() {
+    const std::size_t K = numInstances;
+    const std::size_t stateSize = input.size();
+
+    for (std::size_t n = 0; n < numNeurons; ++n) {
+        const double* f = &fired[n * K];
+        bool any = false;
+        for (std::size_t k = 0; k < K; ++k) {
+            if (f[k] != 0.0) {
+                any = true;
+                ++spikeCounts[k];
+                if (config.recordSpikes) {
+                    spikes[k].push_back(EmittedSpike{n, currentTick});
+                }
+            }
+        }
+        if (!any) {
+            continue;
+        }
+
+        // Una pasada por sinapsis para todas las instancias, enmascarada por f
+        for (std::size_t s = offsets[n]; s < offsets[n + 1]; ++s) {
+            const std::size_t slot = static_cast<std::size_t>(
+                (currentTick + delaySteps[s] + 1) % static_cast<long long>(numSlots));
+            double* dst = &delayRing[slot * stateSize + static_cast<std::size_t>(targets[s]) * K];
+            const double weight = weights[s];
+            for (std::size_t k = 0; k < K; ++k) {
+                dst[k] += weight * f[k];
+            }
+        }
+    }
+}
+
+void EnsembleSimulator::exportSpikesToCSV(std::size_t instance, const std::string& filename) const {
+    const auto& instanceSpikes = getSpikes(instance);
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo para escribir spikes del conjunto.");
+    }
+    file << "NeuronIndex,Time(ms)\n";
+    for (const auto& spike : instanceSpikes) {
+        file << spike.neuronIndex << "," << std::fixed << std::setprecision(3)
+             << spike.tick * config.timeStep << "\n";
+    }
+}
+
+}
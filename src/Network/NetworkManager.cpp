@@ -9,15 +9,151 @@
 #include "ConnectivityStrategies/ScaleFreeConnectivityStrategy.h"
 #include "ConnectivityStrategies/RandomConnectivityStrategy.h"
 #include "Core/Logger.h"
+#include "Parallel/PlacementArena.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <unordered_set>
 
 namespace BioNeuralNetwork {
 
+namespace {
+
+    // Plasticidad de una sinapsis; con Record emite su cambio de peso al recorder
+    template <bool Record, typename Apply>
+    inline void applyPlasticity(IRecorder* recorder, ISynapse& synapse, double eventTime, Apply&& apply) {
+        if constexpr (Record) {
+            const double oldWeight = synapse.getWeight();
+            apply();
+            const double newWeight = synapse.getWeight();
+            if (std::abs(newWeight - oldWeight) > 1e-6) {
+                recorder->recordWeightChange(WeightChangeEvent{synapse.getPreNeuron()->getID(),
+                                                               synapse.getPostNeuron()->getID(),
+                                                               eventTime, oldWeight, newWeight});
+            }
+        } else {
+            (void)recorder;
+            (void)eventTime;
+            apply();
+        }
+    }
+
+    // Elige una vez por bucle la variante con o sin registro: body recibe
+    // std::true_type o std::false_type y lo pasa a applyPlasticity
+    template <typename Body>
+    inline void withRecording(const IRecorder* recorder, Body&& body) {
+        if (recorder) {
+            body(std::true_type{});
+        } else {
+            body(std::false_type{});
+        }
+    }
+
+}
+
 void NetworkManager::addNeuron(std::shared_ptr<INeuron> neuron) {
+    neuron->setSynapticModel(synapticModel);
+    neuronIndices[neuron.get()] = neurons.size();
     neurons.push_back(neuron);
+    if (!stepMultiples.empty()) {
+        stepMultiples.push_back(1);
+    }
+    if (populationStatistics) {
+        populationStatistics->addNeuron(addedNeuronPopulation);
+    }
+    axonIndexDirty = true;
 }
 
 void NetworkManager::addSynapse(std::shared_ptr<ISynapse> synapse) {
     synapses.push_back(synapse);
+    indexSynapse(synapse.get());
+}
+
+void NetworkManager::indexSynapse(ISynapse* synapse) {
+    if (!synapseIndexEnabled) {
+        return;
+    }
+    auto pre = neuronIndices.find(synapse->getPreNeuron().get());
+    auto post = neuronIndices.find(synapse->getPostNeuron().get());
+    if (pre != neuronIndices.end() && post != neuronIndices.end()) {
+        synapseIndex.insert(static_cast<std::uint32_t>(pre->second), static_cast<std::uint32_t>(post->second),
+                            synapse);
+    }
+}
+
+void NetworkManager::rebuildSynapseIndex() {
+    synapseIndex.clear();
+    if (!synapseIndexEnabled) {
+        return;
+    }
+    synapseIndex.reserve(synapses.size());
+    for (const auto &neuron : neurons) {
+        for (const auto &synapse : neuron->getOutgoingSynapses()) {
+            indexSynapse(synapse.get());
+        }
+    }
+}
+
+void NetworkManager::enableSynapseIndex() {
+    synapseIndexEnabled = true;
+    rebuildSynapseIndex();
+}
+
+void NetworkManager::disableSynapseIndex() {
+    synapseIndexEnabled = false;
+    synapseIndex.clear();
+}
+
+ISynapse* NetworkManager::findSynapse(std::size_t pre, std::size_t post) const {
+    if (pre >= neurons.size() || post >= neurons.size()) {
+        throw std::out_of_range("Índice de neurona fuera de rango en findSynapse.");
+    }
+    if (synapseIndexEnabled) {
+        ISynapse* const* found = synapseIndex.find(static_cast<std::uint32_t>(pre), static_cast<std::uint32_t>(post));
+        return found ? *found : nullptr;
+    }
+    const INeuron* target = neurons[post].get();
+    for (const auto &synapse : neurons[pre]->getOutgoingSynapses()) {
+        if (synapse->getPostNeuron().get() == target) {
+            return synapse.get();
+        }
+    }
+    return nullptr;
+}
+
+double NetworkManager::getSynapseWeight(std::size_t pre, std::size_t post) const {
+    const ISynapse* synapse = findSynapse(pre, post);
+    if (!synapse) {
+        throw std::out_of_range("No existe sinapsis entre esas neuronas.");
+    }
+    return synapse->getWeight();
+}
+
+void NetworkManager::setSynapseWeight(std::size_t pre, std::size_t post, double weight) {
+    ISynapse* synapse = findSynapse(pre, post);
+    if (!synapse) {
+        throw std::out_of_range("No existe sinapsis entre esas neuronas.");
+    }
+    synapse->setWeight(weight);
+}
+
+bool NetworkManager::connectIfAbsent(std::size_t pre, std::size_t post, double weight, double delay,
+                                     bool excitatory)
+{
+    if (findSynapse(pre, post)) {
+        return false;
+    }
+    const std::size_t before = synapses.size();
+    if (excitatory) {
+        connectExcitatory(neurons[pre], neurons[post], weight, delay);
+    } else {
+        connectInhibitory(neurons[pre], neurons[post], weight, delay);
+    }
+    return synapses.size() > before;
 }
 
 std::shared_ptr<INeuron> NetworkManager::createNeuron(NeuronType type, const std::vector<double>& params) {
@@ -58,6 +194,8 @@ std::shared_ptr<INeuron> NetworkManager::createNeuron(NeuronType type, const std
         throw std::invalid_argument("Tipo de neurona desconocido.");
     }
 
+    // IDs propios de la red: no dependen de otras redes creadas en el proceso
+    neuron->setID(static_cast<int>(neurons.size()) + 1);
     addNeuron(neuron);
     return neuron;
 }
@@ -70,6 +208,9 @@ void NetworkManager::connectExcitatory(std::shared_ptr<INeuron> pre,
     if (!pre || !post) {
         throw std::invalid_argument("Neurona pre o post nula en connectExcitatory.");
     }
+    if (!acceptsConnection(post)) {
+        return;
+    }
 
     auto synapse = std::make_shared<ExcitatorySynapse>(pre, post, weight, delay);
     addSynapse(synapse);
@@ -86,6 +227,9 @@ void NetworkManager::connectInhibitory(std::shared_ptr<INeuron> pre,
     if (!pre || !post) {
         throw std::invalid_argument("Neurona pre o post nula en connectInhibitory.");
     }
+    if (!acceptsConnection(post)) {
+        return;
+    }
 
     auto synapse = std::make_shared<InhibitorySynapse>(pre, post, weight, delay);
     addSynapse(synapse);
@@ -94,6 +238,577 @@ void NetworkManager::connectInhibitory(std::shared_ptr<INeuron> pre,
     post->addIncomingSynapse(synapse);
 }
 
+void NetworkManager::addConnections(const NetworkBuilder& builder) {
+    addConnections(builder, neurons);
+}
+
+void NetworkManager::addConnections(const NetworkBuilder& builder,
+                                    const std::vector<std::shared_ptr<INeuron>>& endpoints)
+{
+    const std::size_t n = builder.getNumNeurons();
+    if (n > endpoints.size()) {
+        throw std::out_of_range("El builder tiene más neuronas que las indicadas en addConnections.");
+    }
+    const auto &pre = builder.getPre();
+    const auto &post = builder.getPost();
+    const auto &weight = builder.getWeights();
+    const auto &delay = builder.getDelays();
+    const auto &excitatory = builder.getExcitatory();
+
+    // Validación y filtro de destinos locales en una sola pasada
+    std::vector<std::size_t> accepted;
+    accepted.reserve(builder.size());
+    for (std::size_t e = 0; e < builder.size(); ++e) {
+        if (pre[e] >= n || post[e] >= n) {
+            throw std::out_of_range("Arista con índice de neurona fuera de rango en addConnections.");
+        }
+        if (!endpoints[pre[e]] || !endpoints[post[e]]) {
+            throw std::invalid_argument("Neurona pre o post nula en addConnections.");
+        }
+        if (acceptsConnection(endpoints[post[e]])) {
+            accepted.push_back(e);
+        }
+    }
+    const std::size_t m = accepted.size();
+    if (m == 0) {
+        return;
+    }
+
+    // Ordenación por conteo (estable) por neurona pre y por neurona post
+    std::vector<std::size_t> outOffsets(n + 1, 0);
+    std::vector<std::size_t> inOffsets(n + 1, 0);
+    for (std::size_t e : accepted) {
+        ++outOffsets[pre[e] + 1];
+        ++inOffsets[post[e] + 1];
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        outOffsets[i + 1] += outOffsets[i];
+        inOffsets[i + 1] += inOffsets[i];
+    }
+    std::vector<std::size_t> byPre(m);
+    std::vector<std::size_t> byPost(m);
+    {
+        std::vector<std::size_t> outCursor(outOffsets.begin(), outOffsets.end() - 1);
+        std::vector<std::size_t> inCursor(inOffsets.begin(), inOffsets.end() - 1);
+        for (std::size_t k = 0; k < m; ++k) {
+            byPre[outCursor[pre[accepted[k]]]++] = k;
+            byPost[inCursor[post[accepted[k]]]++] = k;
+        }
+    }
+
+    std::vector<std::shared_ptr<ISynapse>> created(m);
+    forEachRange(m, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; ++k) {
+            const std::size_t e = accepted[k];
+            if (excitatory[e]) {
+                created[k] = std::make_shared<ExcitatorySynapse>(endpoints[pre[e]], endpoints[post[e]], weight[e], delay[e]);
+            } else {
+                created[k] = std::make_shared<InhibitorySynapse>(endpoints[pre[e]], endpoints[post[e]], weight[e], delay[e]);
+            }
+        }
+    });
+
+    // Cada neurona la rellena un solo hilo, con sus listas reservadas de antemano
+    forEachRange(n, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const std::size_t outgoing = outOffsets[i + 1] - outOffsets[i];
+            const std::size_t incoming = inOffsets[i + 1] - inOffsets[i];
+            if (outgoing == 0 && incoming == 0) {
+                continue;
+            }
+            endpoints[i]->reserveSynapses(outgoing, incoming);
+            for (std::size_t j = outOffsets[i]; j < outOffsets[i + 1]; ++j) {
+                endpoints[i]->addOutgoingSynapse(created[byPre[j]]);
+            }
+            for (std::size_t j = inOffsets[i]; j < inOffsets[i + 1]; ++j) {
+                endpoints[i]->addIncomingSynapse(created[byPost[j]]);
+            }
+        }
+    });
+
+    if (synapseIndexEnabled) {
+        synapseIndex.reserve(synapseIndex.size() + m);
+        for (const auto &synapse : created) {
+            indexSynapse(synapse.get());
+        }
+    }
+    synapses.reserve(synapses.size() + m);
+    synapses.insert(synapses.end(), std::make_move_iterator(created.begin()), std::make_move_iterator(created.end()));
+}
+
+void NetworkManager::forEachRange(std::size_t total, const std::function<void(std::size_t, std::size_t)>& body) {
+    const std::size_t workers = threadPool ? threadPool->size() : 1;
+    if (workers == 1 || total < workers) {
+        body(0, total);
+        return;
+    }
+    threadPool->runOnAll([&](std::size_t w) {
+        body(total * w / workers, total * (w + 1) / workers);
+    });
+}
+
+void NetworkManager::addProceduralProjection(const ProceduralProjectionConfig& config) {
+    if (config.preEnd > neurons.size() || config.postEnd > neurons.size()) {
+        throw std::out_of_range("La proyección procedural referencia neuronas inexistentes.");
+    }
+    proceduralProjections.emplace_back(config);
+    windowSteps = 0;
+}
+
+bool NetworkManager::acceptsConnection(const std::shared_ptr<INeuron>& post) {
+    // Cualquier cambio de conectividad invalida la ventana (en todos los ranks por igual)
+    windowSteps = 0;
+    axonIndexDirty = true;
+    if (!transport) {
+        return true;
+    }
+    auto it = neuronIndices.find(post.get());
+    return it != neuronIndices.end() && isLocalNeuron(it->second);
+}
+
+void NetworkManager::setSpikeTransport(std::shared_ptr<ISpikeTransport> newTransport) {
+    if (!synapses.empty()) {
+        throw std::logic_error("El transporte debe configurarse antes de crear sinapsis.");
+    }
+    if (structuralPlasticity) {
+        throw std::logic_error("La plasticidad estructural no admite el modo distribuido.");
+    }
+    transport = std::move(newTransport);
+    windowSteps = 0;
+}
+
+bool NetworkManager::isLocalNeuron(std::size_t index) const {
+    if (!transport) {
+        return true;
+    }
+    return static_cast<int>(index % transport->getSize()) == transport->getRank();
+}
+
+std::size_t NetworkManager::getOriginalIndex(std::size_t index) const {
+    if (index >= neurons.size()) {
+        throw std::out_of_range("Índice de neurona fuera de rango en getOriginalIndex.");
+    }
+    return index < originalIndices.size() ? originalIndices[index] : index;
+}
+
+double NetworkManager::getMeanSynapticIndexDistance() const {
+    if (synapses.empty()) {
+        return 0.0;
+    }
+    double total = 0.0;
+    for (const auto &synapse : synapses) {
+        double pre = static_cast<double>(neuronIndices.at(synapse->getPreNeuron().get()));
+        double post = static_cast<double>(neuronIndices.at(synapse->getPostNeuron().get()));
+        total += std::abs(pre - post);
+    }
+    return total / static_cast<double>(synapses.size());
+}
+
+void NetworkManager::reorderNeurons(NeuronOrdering method) {
+    if (transport) {
+        throw std::logic_error("No se puede reordenar la red en modo distribuido.");
+    }
+    if (!proceduralProjections.empty()) {
+        throw std::logic_error("No se puede reordenar una red con proyecciones procedurales.");
+    }
+    if (!eventManager.empty() || !pendingSpikes.empty() || denseLastArrival >= currentTick) {
+        throw std::logic_error("No se puede reordenar la red con spikes en tránsito.");
+    }
+
+    const std::size_t n = neurons.size();
+
+    // Grafo no dirigido de conectividad
+    std::vector<std::vector<std::size_t>> adjacency(n);
+    std::vector<std::pair<std::size_t, std::size_t>> endpoints;
+    endpoints.reserve(synapses.size());
+    for (const auto &synapse : synapses) {
+        std::size_t pre = neuronIndices.at(synapse->getPreNeuron().get());
+        std::size_t post = neuronIndices.at(synapse->getPostNeuron().get());
+        endpoints.emplace_back(pre, post);
+        if (pre != post) {
+            adjacency[pre].push_back(post);
+            adjacency[post].push_back(pre);
+        }
+    }
+    for (auto &list : adjacency) {
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+    }
+
+    const std::vector<std::size_t> order = computeNeuronOrdering(adjacency, method);
+    std::vector<std::size_t> newIndexOf(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        newIndexOf[order[k]] = k;
+    }
+
+    // Volver a crear las neuronas contiguas en el nuevo orden
+    std::vector<std::shared_ptr<INeuron>> reordered;
+    reordered.reserve(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        reordered.push_back(neurons[order[k]]->clone());
+    }
+
+    // Sinapsis agrupadas por neurona pre y ordenadas por destino
+    std::vector<std::size_t> synapseOrder(synapses.size());
+    for (std::size_t s = 0; s < synapseOrder.size(); ++s) {
+        synapseOrder[s] = s;
+    }
+    std::stable_sort(synapseOrder.begin(), synapseOrder.end(), [&](std::size_t a, std::size_t b) {
+        std::size_t preA = newIndexOf[endpoints[a].first];
+        std::size_t preB = newIndexOf[endpoints[b].first];
+        if (preA != preB) return preA < preB;
+        return newIndexOf[endpoints[a].second] < newIndexOf[endpoints[b].second];
+    });
+
+    std::vector<std::shared_ptr<ISynapse>> rewired;
+    rewired.reserve(synapses.size());
+    for (std::size_t s : synapseOrder) {
+        auto &pre = reordered[newIndexOf[endpoints[s].first]];
+        auto &post = reordered[newIndexOf[endpoints[s].second]];
+        auto synapse = synapses[s]->cloneWithEndpoints(pre, post);
+        pre->addOutgoingSynapse(synapse);
+        post->addIncomingSynapse(synapse);
+        rewired.push_back(synapse);
+    }
+
+    // Permutar los arrays por neurona y componer el mapa de índices originales
+    std::vector<double> permutedCurrents(n, 0.0);
+    std::vector<std::size_t> permutedOriginal(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        if (order[k] < externalCurrents.size()) {
+            permutedCurrents[k] = externalCurrents[order[k]];
+        }
+        permutedOriginal[k] = order[k] < originalIndices.size() ? originalIndices[order[k]] : order[k];
+    }
+
+    if (!stepMultiples.empty()) {
+        std::vector<int> permutedMultiples(n);
+        for (std::size_t k = 0; k < n; ++k) {
+            permutedMultiples[k] = stepMultiples[order[k]];
+        }
+        stepMultiples = std::move(permutedMultiples);
+    }
+
+    // Sin vaciar sus listas, la red anterior se mantendría viva por el ciclo neurona-sinapsis
+    releaseGraph(neurons);
+    neurons = std::move(reordered);
+    synapses = std::move(rewired);
+    externalCurrents = std::move(permutedCurrents);
+    originalIndices = std::move(permutedOriginal);
+
+    neuronIndices.clear();
+    for (std::size_t k = 0; k < n; ++k) {
+        neuronIndices[neurons[k].get()] = k;
+    }
+    rebuildSynapseIndex();
+    placementDirty = true;
+    axonIndexDirty = true;
+
+    // Las sondas siguen registrando las mismas neuronas y sinapsis
+    for (auto &probe : probes) {
+        probe->remapTargets(newIndexOf);
+    }
+    bindProbes();
+}
+
+void NetworkManager::enablePopulationStatistics(const PopulationStatisticsConfig& config,
+                                                const std::vector<std::size_t>& populations)
+{
+    populationStatistics = std::make_unique<PopulationStatistics>(neurons.size(), populations, config,
+                                                                  getCurrentTime());
+    addedNeuronPopulation = populations.empty() ? 0 : populationStatistics->getNumPopulations();
+}
+
+bool NetworkManager::setHardwareCountersEnabled(bool enabled) {
+    hardwareCounters.reset();
+    if (!enabled) {
+        return false;
+    }
+    const std::size_t slots = parallelConfig.numThreads > 1 ? parallelConfig.numThreads + 1 : 1;
+    hardwareCounters = std::make_unique<HardwareCounterProfiler>(slots);
+    return hardwareCounters->probe();
+}
+
+void NetworkManager::setLogger(Logger* newLogger) {
+    logger = newLogger;
+    updateRecorders();
+}
+
+void NetworkManager::addRecorder(std::shared_ptr<IRecorder> recorder) {
+    if (!recorder) {
+        throw std::invalid_argument("El recorder no puede ser nulo.");
+    }
+    recorders.push_back(std::move(recorder));
+    updateRecorders();
+}
+
+void NetworkManager::clearRecorders() {
+    recorders.clear();
+    updateRecorders();
+}
+
+void NetworkManager::flushRecorders() {
+    for (auto &recorder : recorders) {
+        recorder->flush();
+    }
+}
+
+void NetworkManager::updateRecorders() {
+    std::vector<IRecorder*> targets;
+    if (logger) {
+        targets.push_back(logger);
+    }
+    for (const auto &recorder : recorders) {
+        targets.push_back(recorder.get());
+    }
+    // Con un solo destino no hace falta el reenvío
+    activeRecorder = targets.empty() ? nullptr : targets.size() == 1 ? targets.front() : &recorderFanOut;
+    recorderFanOut = RecorderSet(std::move(targets));
+}
+
+NetworkManager::~NetworkManager() {
+    releaseGraph(neurons);
+}
+
+void NetworkManager::releaseGraph(const std::vector<std::shared_ptr<INeuron>>& graph) {
+    for (const auto &neuron : graph) {
+        neuron->removeSynapsesIf([](const ISynapse&) { return true; });
+    }
+}
+
+std::unique_ptr<NetworkManager> NetworkManager::cloneNetwork() const {
+    if (transport) {
+        throw std::logic_error("No se puede copiar una red en modo distribuido.");
+    }
+    if (!eventManager.empty() || denseLastArrival >= currentTick) {
+        throw std::logic_error("cloneNetwork requiere la cola de eventos vacía.");
+    }
+
+    auto copy = std::make_unique<NetworkManager>();
+    copy->logger = logger;
+    copy->recorders = recorders;
+    copy->updateRecorders();
+    copy->timeStep = timeStep;
+    copy->currentTick = currentTick;
+    copy->backgroundCurrent = backgroundCurrent;
+    copy->synapticModel = synapticModel;
+    copy->originalIndices = originalIndices;
+    copy->proceduralProjections = proceduralProjections;
+    copy->proceduralRing = proceduralRing;
+    copy->proceduralSlots = proceduralSlots;
+    copy->proceduralLastArrival = proceduralLastArrival;
+    copy->quiescentSkipping = quiescentSkipping;
+    copy->quiescentTolerance = quiescentTolerance;
+    copy->structuralPlasticity = structuralPlasticity;
+    copy->structuralConfig = structuralConfig;
+    copy->nextStructuralReview = nextStructuralReview;
+    copy->lastStructuralReview = lastStructuralReview;
+    copy->structuralRng = structuralRng;
+
+    copy->neurons.reserve(neurons.size());
+    for (const auto &neuron : neurons) {
+        copy->addNeuron(neuron->clone());
+    }
+    copy->stepMultiples = stepMultiples;
+    copy->stepMultipleLcm = stepMultipleLcm;
+
+    // Las listas salientes se recorren en su orden original para conservar el orden de entrega
+    std::unordered_map<const ISynapse*, std::shared_ptr<ISynapse>> copies;
+    copies.reserve(synapses.size());
+    for (std::size_t i = 0; i < neurons.size(); ++i) {
+        for (const auto &synapse : neurons[i]->getOutgoingSynapses()) {
+            auto post = neuronIndices.find(synapse->getPostNeuron().get());
+            if (post == neuronIndices.end()) {
+                throw std::logic_error("La red contiene sinapsis hacia neuronas no gestionadas.");
+            }
+            auto cloned = synapse->cloneWithEndpoints(copy->neurons[i], copy->neurons[post->second]);
+            copy->neurons[i]->addOutgoingSynapse(cloned);
+            copies[synapse.get()] = cloned;
+        }
+    }
+    for (std::size_t i = 0; i < neurons.size(); ++i) {
+        for (const auto &synapse : neurons[i]->getIncomingSynapses()) {
+            copy->neurons[i]->addIncomingSynapse(copies.at(synapse.get()));
+        }
+    }
+    for (const auto &synapse : synapses) {
+        copy->addSynapse(copies.at(synapse.get()));
+    }
+    if (synapseIndexEnabled) {
+        copy->enableSynapseIndex();
+    }
+    return copy;
+}
+
+void NetworkManager::setParallelConfig(const ParallelConfig& config) {
+    if (config.numThreads == 0) {
+        throw std::invalid_argument("El número de hilos debe ser al menos 1.");
+    }
+    if (config.fanOutChunkSize == 0) {
+        throw std::invalid_argument("El tamaño de trozo de propagación debe ser positivo.");
+    }
+    parallelConfig = config;
+    windowSteps = 0;
+    scheduler.reset();
+    threadPool.reset();
+    partitionBounds.clear();
+    placementReport.clear();
+    placementDirty = true;
+    // Ranura 0 para el hilo principal y una por hilo de simulación
+    profiler.configure(config.numThreads > 1 ? config.numThreads + 1 : 1);
+    if (hardwareCounters) {
+        // Los grupos de contadores pertenecen a los hilos anteriores
+        setHardwareCountersEnabled(true);
+    }
+
+    if (config.numThreads > 1) {
+        numaTopology = NumaTopology::detect();
+        threadPool = std::make_unique<SimulationThreadPool>(config.numThreads, config.pinThreads, numaTopology);
+        scheduler = std::make_unique<WorkStealingScheduler>(*threadPool);
+        partitionFired.assign(config.numThreads, {});
+    }
+}
+
+void NetworkManager::updatePartitions() {
+    const std::size_t parts = threadPool ? threadPool->size() : 1;
+    if (partitionBounds.size() == parts + 1 && partitionBounds.back() == neurons.size()) {
+        return;
+    }
+    partitionBounds.assign(parts + 1, 0);
+    for (std::size_t w = 0; w <= parts; ++w) {
+        partitionBounds[w] = neurons.size() * w / parts;
+    }
+}
+
+void NetworkManager::placeMemory() {
+    updatePartitions();
+    placementDirty = false;
+
+    const std::size_t n = neurons.size();
+    const std::size_t parts = threadPool->size();
+    auto partitionOf = [&](std::size_t index) {
+        return static_cast<std::size_t>(
+            std::upper_bound(partitionBounds.begin(), partitionBounds.end(), index) - partitionBounds.begin() - 1);
+    };
+
+    // Solo se puede recolocar si todas las sinapsis conectan neuronas gestionadas
+    std::vector<std::size_t> preOf(synapses.size());
+    std::vector<std::size_t> postOf(synapses.size());
+    for (std::size_t s = 0; s < synapses.size(); ++s) {
+        auto pre = neuronIndices.find(synapses[s]->getPreNeuron().get());
+        auto post = neuronIndices.find(synapses[s]->getPostNeuron().get());
+        if (pre == neuronIndices.end() || post == neuronIndices.end()) {
+            buildPlacementReport(false);
+            return;
+        }
+        preOf[s] = pre->second;
+        postOf[s] = post->second;
+    }
+
+    // Sinapsis por partición de la neurona post y, por neurona pre, en su orden original
+    std::vector<std::vector<std::size_t>> synapsesByPartition(parts);
+    std::vector<std::size_t> outgoingOffsets(n + 1, 0);
+    for (std::size_t s = 0; s < synapses.size(); ++s) {
+        synapsesByPartition[partitionOf(postOf[s])].push_back(s);
+        ++outgoingOffsets[preOf[s] + 1];
+    }
+    for (std::size_t i = 0; i < n; ++i) {
+        outgoingOffsets[i + 1] += outgoingOffsets[i];
+    }
+    std::vector<std::size_t> outgoingList(synapses.size());
+    std::vector<std::size_t> cursor(outgoingOffsets.begin(), outgoingOffsets.end() - 1);
+    for (std::size_t s = 0; s < synapses.size(); ++s) {
+        outgoingList[cursor[preOf[s]]++] = s;
+    }
+
+    std::vector<std::shared_ptr<INeuron>> placed(n);
+    std::vector<std::shared_ptr<ISynapse>> placedSynapses(synapses.size());
+
+    // Primer contacto de cada partición desde el hilo que la integra, en una arena
+    // propia: el estado de sus neuronas y sinapsis entrantes queda contiguo
+    std::vector<std::shared_ptr<PlacementArena>> arenas(parts);
+    threadPool->runOnAll([&](std::size_t w) {
+        arenas[w] = std::make_shared<PlacementArena>(parallelConfig.transparentHugePages);
+        for (std::size_t i = partitionBounds[w]; i < partitionBounds[w + 1]; ++i) {
+            placed[i] = neurons[i]->cloneInto(arenas[w]);
+        }
+    });
+    threadPool->runOnAll([&](std::size_t w) {
+        for (std::size_t s : synapsesByPartition[w]) {
+            placedSynapses[s] = synapses[s]->cloneWithEndpointsInto(placed[preOf[s]], placed[postOf[s]], arenas[w]);
+            placed[postOf[s]]->addIncomingSynapse(placedSynapses[s]);
+        }
+    });
+    threadPool->runOnAll([&](std::size_t w) {
+        for (std::size_t i = partitionBounds[w]; i < partitionBounds[w + 1]; ++i) {
+            for (std::size_t k = outgoingOffsets[i]; k < outgoingOffsets[i + 1]; ++k) {
+                placed[i]->addOutgoingSynapse(placedSynapses[outgoingList[k]]);
+            }
+        }
+    });
+
+    // La red anterior se libera junto con las arenas que la contenían
+    releaseGraph(neurons);
+    neurons = std::move(placed);
+    synapses = std::move(placedSynapses);
+    neuronIndices.clear();
+    for (std::size_t i = 0; i < n; ++i) {
+        neuronIndices[neurons[i].get()] = i;
+    }
+    rebuildSynapseIndex();
+    axonIndexDirty = true;
+
+    // Las arenas viven mientras lo hagan sus objetos
+    bool advised = parallelConfig.transparentHugePages;
+    for (const auto &arena : arenas) {
+        advised = advised && (arena->getReservedBytes() == 0 || arena->hugePagesAdvised());
+    }
+    buildPlacementReport(advised);
+}
+
+void NetworkManager::buildPlacementReport(bool hugePagesAdvised) {
+    placementReport.clear();
+    if (!threadPool) {
+        return;
+    }
+
+    std::vector<std::size_t> synapseCount(threadPool->size(), 0);
+    for (std::size_t w = 0; w < threadPool->size(); ++w) {
+        for (std::size_t i = partitionBounds[w]; i < partitionBounds[w + 1]; ++i) {
+            synapseCount[w] += neurons[i]->getIncomingSynapses().size();
+        }
+    }
+
+    const std::size_t maxSamples = 64;
+    for (std::size_t w = 0; w < threadPool->size(); ++w) {
+        PartitionPlacement p{w, threadPool->getCpu(w), threadPool->getNode(w),
+                             partitionBounds[w], partitionBounds[w + 1], synapseCount[w],
+                             0, 0, hugePagesAdvised};
+        const std::size_t count = p.endNeuron - p.firstNeuron;
+        const std::size_t stride = std::max<std::size_t>(1, count / maxSamples);
+        for (std::size_t i = p.firstNeuron; i < p.endNeuron; i += stride) {
+            int node = NumaTopology::getNodeOfAddress(neurons[i].get());
+            if (node < 0) continue;
+            ++p.sampledPages;
+            if (node == p.node) ++p.pagesOnNode;
+        }
+        placementReport.push_back(p);
+    }
+}
+
+void NetworkManager::printPlacementReport(std::ostream& out) const {
+    out << "Colocación de particiones (" << numaTopology.getNumNodes() << " nodo(s) NUMA):\n";
+    for (const auto& p : placementReport) {
+        out << " - Hilo " << p.worker
+            << " | CPU " << (p.cpu >= 0 ? std::to_string(p.cpu) : std::string("libre"))
+            << " | nodo " << p.node
+            << " | neuronas [" << p.firstNeuron << ", " << p.endNeuron << ")"
+            << " | sinapsis " << p.synapses
+            << " | páginas en nodo " << p.pagesOnNode << "/" << p.sampledPages
+            << (p.hugePagesAdvised ? " | THP" : "") << "\n";
+    }
+}
+
 void NetworkManager::setConnectivityStrategy(std::unique_ptr<IConnectivityStrategy> strategy) {
     connectivityStrategy = std::move(strategy);
 }
@@ -107,117 +822,1431 @@ void NetworkManager::applyConnectivityStrategy() {
     }
 }
 
-void NetworkManager::runSimulation(double tMax, double dt) {
-    double currentTime = 0.0;
-    int steps = static_cast<int>(tMax / dt);
+void NetworkManager::setSynapticModel(const SynapticModel& model) {
+    if (model.dynamics != SynapseDynamics::Instantaneous &&
+        (model.tauExcitatory <= 0.0 || model.tauInhibitory <= 0.0)) {
+        throw std::invalid_argument("Las constantes de tiempo sinápticas deben ser positivas.");
+    }
+    synapticModel = model;
+    for (auto &neuron : neurons) {
+        neuron->setSynapticModel(model);
+    }
+}
 
-    for (int step = 0; step < steps; ++step) {
-        currentTime = step * dt;
+void NetworkManager::setTimeStep(double dt) {
+    if (dt <= 0.0) {
+        throw std::invalid_argument("El paso de simulación debe ser positivo.");
+    }
+    if (dt != timeStep) {
+        // Los pasos de llegada del bitset dependen de dt
+        spillDenseSpikes();
+        timeStep = dt;
+        windowSteps = 0;
+        axonIndexDirty = true;
+    }
+}
 
-        for (auto &neuron : neurons) {
-            neuron->injectCurrent(10.0);
+void NetworkManager::setPopulationTiming(const std::vector<std::size_t>& populations,
+                                         const std::vector<PopulationTiming>& timing)
+{
+    if (populations.size() != neurons.size()) {
+        throw std::invalid_argument("Se necesita una población por neurona en setPopulationTiming.");
+    }
+    for (const auto &entry : timing) {
+        if (entry.stepMultiple < 1 || entry.izhikevichSubstep < 0.0) {
+            throw std::invalid_argument("El múltiplo del paso debe ser >= 1 y el subpaso no negativo.");
         }
-
-        for (auto &neuron : neurons) {
-            neuron->stepSimulation(dt, currentTime);
-
-            if (neuron->hasFired()) {
-                neuron->setLastSpikeTime(currentTime);
-                for (auto &synapse : neuron->getOutgoingSynapses()) {
-                    double synDelay = synapse->getDelay();
-                    double arrivalTime = currentTime + synDelay;
-                    SpikeEvent event(arrivalTime, neuron, synapse);
-                    eventManager.pushEvent(event);
-                }
-                for (auto &synapse : neuron->getIncomingSynapses()) {
-                    synapse->deliverSpikeFromPost(neuron, currentTime);
-                }
-            }
+    }
+    for (std::size_t population : populations) {
+        if (population >= timing.size()) {
+            throw std::out_of_range("Población sin configuración de paso en setPopulationTiming.");
         }
+    }
 
-        while (!eventManager.empty() && eventManager.nextEventTime() <= currentTime) {
-            SpikeEvent e = eventManager.popEvent();
-            auto synapsePtr = e.synapse.lock();
-            auto preNeuronPtr = e.preNeuron.lock();
-            if (synapsePtr && preNeuronPtr) {
-                synapsePtr->deliverSpikeFromPre(preNeuronPtr, e.time);
-            }
+    std::vector<int> multiples(neurons.size());
+    long long lcm = 1;
+    for (std::size_t i = 0; i < neurons.size(); ++i) {
+        const PopulationTiming &entry = timing[populations[i]];
+        multiples[i] = entry.stepMultiple;
+        lcm = std::lcm(lcm, static_cast<long long>(entry.stepMultiple));
+        if (auto izhikevich = std::dynamic_pointer_cast<IzhikevichNeuron>(neurons[i])) {
+            izhikevich->setSubstep(entry.izhikevichSubstep);
         }
     }
 
-    try {
-        Logger::getInstance().exportSpikesToCSV("output_logs/spikes.csv");
-        Logger::getInstance().exportWeightChangesToCSV("output_logs/weight_changes.csv");
-        Logger::getInstance().exportLogsToText("output_logs/simulation_logs.txt");
-        std::cout << "Logs exportados exitosamente.\n";
+    // Con todos los múltiplos a 1 se conserva el camino de un solo paso
+    if (lcm == 1) {
+        stepMultiples.clear();
+    } else {
+        stepMultiples = std::move(multiples);
     }
-    catch (const std::exception& e) {
-        std::cerr << "Error al exportar logs: " << e.what() << "\n";
+    stepMultipleLcm = lcm;
+}
+
+int NetworkManager::getStepMultiple(std::size_t neuronIndex) const {
+    if (neuronIndex >= neurons.size()) {
+        throw std::out_of_range("Índice de neurona fuera de rango en getStepMultiple.");
     }
+    return stepMultiples.empty() ? 1 : stepMultiples[neuronIndex];
 }
 
-void NetworkManager::createNetwork(const NetworkConfig& config) {
-    // 1. Crear neuronas excitatorias
-    int numExcitatory = static_cast<int>(config.totalNeurons * config.excitatoryRatio);
-    int numInhibitory = static_cast<int>(config.totalNeurons * config.inhibitoryRatio);
+void NetworkManager::injectExternalCurrent(std::size_t neuronIndex, double current) {
+    if (neuronIndex >= neurons.size()) {
+        throw std::out_of_range("Índice de neurona fuera de rango en injectExternalCurrent.");
+    }
+    externalCurrents.resize(neurons.size(), 0.0);
+    externalCurrents[neuronIndex] += current;
+}
 
-    for (int i = 0; i < numExcitatory; ++i) {
-        createNeuron(NeuronType::Izhikevich,
-                     {0.02, 0.2, -65.0, 8.0, 30.0, -65.0, 1.0, 1.0, 2.0});
+void NetworkManager::updateExchangeWindow() {
+    if (!transport && !parallelConfig.minDelayWindows) {
+        windowSteps = 1;
+        return;
     }
 
-    for (int i = 0; i < numInhibitory; ++i) {
-        createNeuron(NeuronType::Izhikevich,
-                     {0.1, 0.2, -65.0, 2.0, 30.0, -65.0, 1.0, 1.0, 2.0});
+    double minDelay = std::numeric_limits<double>::infinity();
+    for (const auto &synapse : synapses) {
+        minDelay = std::min(minDelay, synapse->getDelay());
+    }
+    for (const auto &projection : proceduralProjections) {
+        minDelay = std::min(minDelay, projection.getConfig().minDelay);
+    }
+    if (transport) {
+        minDelay = transport->minAcrossRanks(minDelay);
     }
 
+    // Un spike emitido en la ventana no puede llegar antes de que termine
+    long long steps = std::isfinite(minDelay)
+        ? static_cast<long long>(std::floor(minDelay / timeStep + 1e-9))
+        : 1;
+    windowSteps = std::max(1LL, steps);
+}
+
+void NetworkManager::advance(long long untilTick) {
+    recentSpikes.clear();
+    externalCurrents.resize(neurons.size(), 0.0);
+    if (windowSteps == 0) {
+        updateExchangeWindow();
+    }
+    resizeProceduralRing();
+    if (!usesDenseDelivery()) {
+        spillDenseSpikes();
+    }
+    if (threadPool || usesMinDelayWindows()) {
+        updatePartitions();
+    }
+    if (threadPool) {
+        // Recolocar solo sin eventos en vuelo, que referencian los objetos actuales
+        if (placementDirty && !neurons.empty() && eventManager.empty() && pendingSpikes.empty() &&
+            denseLastArrival < currentTick) {
+            if (parallelConfig.numaFirstTouch) {
+                const auto placementStart = std::chrono::steady_clock::now();
+                placeMemory();
+                stats.placementSeconds += std::chrono::duration<double>(
+                    std::chrono::steady_clock::now() - placementStart).count();
+            } else {
+                placementDirty = false;
+                buildPlacementReport(false);
+            }
+        }
+    }
+    if (axonIndexDirty) {
+        rebuildAxonIndex();
+    }
+    bindProbes();
+
+    // Neuronas locales por múltiplo del paso, para contar las actualizaciones reales
+    std::vector<std::pair<long long, std::uint64_t>> multipleGroups;
+    for (std::size_t i = 0; i < stepMultiples.size(); ++i) {
+        if (!isLocalNeuron(i)) {
+            continue;
+        }
+        auto group = std::find_if(multipleGroups.begin(), multipleGroups.end(),
+                                  [&](const auto &g) { return g.first == stepMultiples[i]; });
+        if (group == multipleGroups.end()) {
+            multipleGroups.emplace_back(stepMultiples[i], 1);
+        } else {
+            ++group->second;
+        }
+    }
+
+    const auto wallStart = std::chrono::steady_clock::now();
+    const long long firstTick = currentTick;
+    long long skipped = 0;
+    std::uint64_t multiRateUpdates = 0;
+    while (currentTick < untilTick) {
+        if (structuralPlasticity && currentTick >= nextStructuralReview) {
+            applyStructuralPlasticity();
+        }
+        if (quiescentSkipping) {
+            // Sin saltar por encima de la siguiente revisión estructural ni de una muestra
+            long long limit = std::min(untilTick, nextProbeTick());
+            if (structuralPlasticity) {
+                limit = std::min(limit, nextStructuralReview);
+            }
+            const long long jump = skipQuiescentSteps(limit);
+            if (jump > 0) {
+                skipped += jump;
+                continue;
+            }
+        }
+        const long long windowStart = currentTick;
+        if (usesMinDelayWindows()) {
+            // Sin pasar de una muestra ni de la siguiente revisión estructural
+            long long windowEnd = std::min(untilTick, currentTick + windowSteps);
+            const long long toSample = std::max(0LL, nextProbeTick() - currentTick);
+            if (toSample < windowEnd - currentTick) {
+                windowEnd = currentTick + toSample + 1;
+            }
+            if (structuralPlasticity) {
+                windowEnd = std::min(windowEnd, std::max(currentTick + 1, nextStructuralReview));
+            }
+            runMinDelayWindow(windowEnd);
+        } else {
+            stepOnce();
+        }
+        for (long long tick = windowStart; tick <= currentTick; ++tick) {
+            for (const auto &group : multipleGroups) {
+                multiRateUpdates += (tick + 1) % group.first == 0 ? group.second : 0;
+            }
+        }
+        for (auto &probe : probes) {
+            probe->sample(currentTick);
+        }
+        ++currentTick;
+    }
+    const long long steps = currentTick - firstTick;
+    if (steps > 0) {
+        std::size_t localNeurons = neurons.size();
+        if (transport) {
+            localNeurons = 0;
+            for (std::size_t i = 0; i < neurons.size(); ++i) {
+                localNeurons += isLocalNeuron(i) ? 1 : 0;
+            }
+        }
+        stats.neuronUpdates += stepMultiples.empty()
+            ? static_cast<std::uint64_t>(steps - skipped) * localNeurons
+            : multiRateUpdates;
+        stats.steps += steps;
+        stats.skippedSteps += skipped;
+        stats.simulatedMs += steps * timeStep;
+        stats.wallSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    }
+
+    // Cerrar la ventana abierta para que el estado quede completo entre llamadas
+    if (stepsInWindow > 0) {
+        flushSpikeWindow();
+    }
+}
+
+void NetworkManager::rebuildAxonIndex() {
+    // Los spikes del bitset se refieren a los grupos actuales: pasan a la cola
+    spillDenseSpikes();
+    axonIndexDirty = false;
+    deadAxonSynapses = 0;
+    deadAxonBuckets = 0;
+    const std::size_t n = neurons.size();
+    axonBucketBegin.assign(n, 0);
+    axonBucketEnd.assign(n, 0);
+    bucketDelay.clear();
+    bucketSynapseBegin.clear();
+    bucketSynapseEnd.clear();
+    axonSynapses.clear();
+    axonSynapses.reserve(synapses.size());
+    axonSynapsePost.clear();
+    axonSynapsePost.reserve(synapses.size());
+
+    std::vector<std::pair<ISynapse*, std::uint32_t>> grouped;
+    for (std::size_t i = 0; i < n; ++i) {
+        grouped.clear();
+        for (const auto &synapse : neurons[i]->getOutgoingSynapses()) {
+            grouped.emplace_back(synapse.get(),
+                                 static_cast<std::uint32_t>(neuronIndices.at(synapse->getPostNeuron().get())));
+        }
+        // Dentro de un grupo, por neurona post: cada partición de hilos ocupa un rango
+        // contiguo. Orden estable: las sinapsis hacia la misma post conservan el suyo
+        std::stable_sort(grouped.begin(), grouped.end(), [](const auto &a, const auto &b) {
+            if (a.first->getDelay() != b.first->getDelay()) {
+                return a.first->getDelay() < b.first->getDelay();
+            }
+            return a.second < b.second;
+        });
+        axonBucketBegin[i] = bucketDelay.size();
+        for (std::size_t k = 0; k < grouped.size(); ++k) {
+            if (k == 0 || grouped[k].first->getDelay() != grouped[k - 1].first->getDelay()) {
+                if (k > 0) {
+                    bucketSynapseEnd.push_back(axonSynapses.size());
+                }
+                bucketDelay.push_back(grouped[k].first->getDelay());
+                bucketSynapseBegin.push_back(axonSynapses.size());
+            }
+            axonSynapses.push_back(grouped[k].first);
+            axonSynapsePost.push_back(grouped[k].second);
+        }
+        if (!grouped.empty()) {
+            bucketSynapseEnd.push_back(axonSynapses.size());
+        }
+        axonBucketEnd[i] = bucketDelay.size();
+    }
+
+    bucketSteps.resize(bucketDelay.size());
+    for (std::size_t b = 0; b < bucketDelay.size(); ++b) {
+        bucketSteps[b] = std::max(0LL, static_cast<long long>(std::ceil(bucketDelay[b] / timeStep - 1e-9)));
+    }
+    denseOffsets = bucketSteps;
+    std::sort(denseOffsets.begin(), denseOffsets.end(), std::greater<long long>());
+    denseOffsets.erase(std::unique(denseOffsets.begin(), denseOffsets.end()), denseOffsets.end());
+    denseSlots = denseOffsets.empty() ? 0 : static_cast<std::size_t>(denseOffsets.front()) + 1;
+    denseWords = (n + 63) / 64;
+    spikeBits.assign(denseSlots * denseWords, 0);
+    denseSlotTick.assign(denseSlots, -1);
+    rebuildDenseBuckets();
+}
+
+void NetworkManager::rebuildDenseBuckets() {
+    denseBucketsDirty = false;
+    auto offsetOf = [&](std::size_t b) {
+        return static_cast<std::size_t>(std::lower_bound(denseOffsets.begin(), denseOffsets.end(), bucketSteps[b],
+                                                         std::greater<long long>()) - denseOffsets.begin());
+    };
+    // Ordenación por conteo: dentro de cada retardo, por neurona pre y en el orden de sus grupos
+    denseOffsetBegin.assign(denseOffsets.size() + 1, 0);
+    for (std::size_t i = 0; i < axonBucketBegin.size(); ++i) {
+        for (std::size_t b = axonBucketBegin[i]; b < axonBucketEnd[i]; ++b) {
+            if (bucketSynapseBegin[b] != bucketSynapseEnd[b]) {
+                ++denseOffsetBegin[offsetOf(b) + 1];
+            }
+        }
+    }
+    for (std::size_t o = 0; o < denseOffsets.size(); ++o) {
+        denseOffsetBegin[o + 1] += denseOffsetBegin[o];
+    }
+    denseBuckets.resize(denseOffsetBegin.back());
+    std::vector<std::size_t> cursor(denseOffsetBegin.begin(), denseOffsetBegin.end() - 1);
+    for (std::size_t i = 0; i < axonBucketBegin.size(); ++i) {
+        for (std::size_t b = axonBucketBegin[i]; b < axonBucketEnd[i]; ++b) {
+            if (bucketSynapseBegin[b] != bucketSynapseEnd[b]) {
+                denseBuckets[cursor[offsetOf(b)]++] = DenseBucket{b, static_cast<std::uint32_t>(i)};
+            }
+        }
+    }
+}
+
+void NetworkManager::removeAxonSynapses(const std::vector<std::size_t>& pres,
+                                        const std::unordered_set<const ISynapse*>& pruned)
+{
+    // Compacta en su sitio los grupos de las neuronas pre afectadas, conservando el orden
+    for (std::size_t pre : pres) {
+        for (std::size_t b = axonBucketBegin[pre]; b < axonBucketEnd[pre]; ++b) {
+            std::size_t kept = bucketSynapseBegin[b];
+            for (std::size_t k = bucketSynapseBegin[b]; k < bucketSynapseEnd[b]; ++k) {
+                if (pruned.count(axonSynapses[k]) == 0) {
+                    axonSynapses[kept] = axonSynapses[k];
+                    axonSynapsePost[kept] = axonSynapsePost[k];
+                    ++kept;
+                }
+            }
+            deadAxonSynapses += bucketSynapseEnd[b] - kept;
+            bucketSynapseEnd[b] = kept;
+        }
+    }
+}
+
+void NetworkManager::insertAxonSynapse(std::size_t pre, std::size_t post, ISynapse* synapse) {
+    const double delay = synapse->getDelay();
+    const auto first = bucketDelay.begin() + static_cast<std::ptrdiff_t>(axonBucketBegin[pre]);
+    const auto last = bucketDelay.begin() + static_cast<std::ptrdiff_t>(axonBucketEnd[pre]);
+    const auto found = std::lower_bound(first, last, delay);
+    std::size_t b = static_cast<std::size_t>(found - bucketDelay.begin());
+
+    if (found == last || *found != delay) {
+        const long long steps = std::max(0LL, static_cast<long long>(std::ceil(delay / timeStep - 1e-9)));
+        if (!std::binary_search(denseOffsets.begin(), denseOffsets.end(), steps, std::greater<long long>())) {
+            // Un retardo nuevo cambia las ranuras del bitset: sus spikes pasan a la cola
+            spillDenseSpikes();
+            denseOffsets.insert(std::upper_bound(denseOffsets.begin(), denseOffsets.end(), steps,
+                                                 std::greater<long long>()), steps);
+            denseSlots = static_cast<std::size_t>(denseOffsets.front()) + 1;
+            spikeBits.assign(denseSlots * denseWords, 0);
+            denseSlotTick.assign(denseSlots, -1);
+        }
+        // Los grupos de la neurona pasan al final, con el nuevo en su posición por retardo
+        const std::size_t begin = axonBucketBegin[pre];
+        const std::size_t end = axonBucketEnd[pre];
+        const std::size_t moved = bucketDelay.size();
+        for (std::size_t k = begin; k <= end; ++k) {
+            if (k == b) {
+                bucketDelay.push_back(delay);
+                bucketSteps.push_back(steps);
+                bucketSynapseBegin.push_back(axonSynapses.size());
+                bucketSynapseEnd.push_back(axonSynapses.size());
+            }
+            if (k < end) {
+                bucketDelay.push_back(bucketDelay[k]);
+                bucketSteps.push_back(bucketSteps[k]);
+                bucketSynapseBegin.push_back(bucketSynapseBegin[k]);
+                bucketSynapseEnd.push_back(bucketSynapseEnd[k]);
+            }
+        }
+        b = moved + (b - begin);
+        axonBucketBegin[pre] = moved;
+        axonBucketEnd[pre] = bucketDelay.size();
+        deadAxonBuckets += end - begin;
+        denseBucketsDirty = true;
+    }
+
+    if (bucketSynapseBegin[b] == bucketSynapseEnd[b]) {
+        // Los grupos vacíos no figuran en las listas de la entrega densa
+        denseBucketsDirty = true;
+    }
+    if (bucketSynapseEnd[b] != axonSynapses.size()) {
+        // Sin sitio detrás del grupo: se traslada al final de axonSynapses
+        const std::size_t begin = bucketSynapseBegin[b];
+        const std::size_t end = bucketSynapseEnd[b];
+        bucketSynapseBegin[b] = axonSynapses.size();
+        for (std::size_t k = begin; k < end; ++k) {
+            axonSynapses.push_back(axonSynapses[k]);
+            axonSynapsePost.push_back(axonSynapsePost[k]);
+        }
+        bucketSynapseEnd[b] = axonSynapses.size();
+        deadAxonSynapses += end - begin;
+    }
+    // Tras las sinapsis hacia la misma post, como al reconstruir el índice
+    const auto posts = axonSynapsePost.begin();
+    const auto at = std::upper_bound(posts + static_cast<std::ptrdiff_t>(bucketSynapseBegin[b]),
+                                     posts + static_cast<std::ptrdiff_t>(bucketSynapseEnd[b]),
+                                     static_cast<std::uint32_t>(post)) - posts;
+    axonSynapses.insert(axonSynapses.begin() + at, synapse);
+    axonSynapsePost.insert(axonSynapsePost.begin() + at, static_cast<std::uint32_t>(post));
+    ++bucketSynapseEnd[b];
+}
+
+void NetworkManager::propagateSpike(std::size_t neuronIndex, double spikeTime) {
+    for (std::size_t b = axonBucketBegin[neuronIndex]; b < axonBucketEnd[neuronIndex]; ++b) {
+        // Los grupos vaciados por la poda se conservan hasta reconstruir el índice
+        if (bucketSynapseBegin[b] != bucketSynapseEnd[b]) {
+            stagedEvents.emplace_back(spikeTime + bucketDelay[b], bucketDelay[b],
+                                      static_cast<std::uint32_t>(neuronIndex));
+        }
+    }
+}
+
+bool NetworkManager::useChunkedFanOut(std::size_t totalSynapses) const {
+    // Por debajo de dos trozos no compensa despertar a los hilos
+    return scheduler && totalSynapses >= 2 * parallelConfig.fanOutChunkSize;
+}
+
+void NetworkManager::propagatePendingSpikes() {
+    if (usesDenseDelivery() && !pendingSpikes.empty() && !denseOffsets.empty() && chooseDenseDelivery()) {
+        recordDenseSpikes();
+        return;
+    }
+
+    // Un evento por grupo de retardo; las sinapsis se recorren al entregarlo
+    const double dt = timeStep;
+    stagedEvents.clear();
+    for (const auto &spike : pendingSpikes) {
+        propagateSpike(spike.neuronIndex, spike.tick * dt);
+    }
+    eventManager.pushEvents(stagedEvents);
+}
+
+bool NetworkManager::chooseDenseDelivery() const {
+    if (deliveryMode == DeliveryMode::Dense) {
+        return true;
+    }
+    // Cola: insertar y extraer un evento por spike y grupo de retardo. Bitset:
+    // limpiar la ranura y, a la llegada de cada retardo, recorrer sus grupos
+    std::size_t events = 0;
+    for (const auto &spike : pendingSpikes) {
+        events += axonBucketEnd[spike.neuronIndex] - axonBucketBegin[spike.neuronIndex];
+    }
+    const double queueCost = 2.0 * static_cast<double>(events) *
+                             std::log2(static_cast<double>(eventManager.size() + events) + 2.0);
+    const double denseCost = static_cast<double>(denseWords + denseBuckets.size());
+    return denseCost < queueCost;
+}
+
+void NetworkManager::recordDenseSpikes() {
+    // Sin transporte ni ventanas, los spikes pendientes son todos del mismo paso
+    const long long tick = pendingSpikes.front().tick;
+    const std::size_t slot = static_cast<std::size_t>(tick % static_cast<long long>(denseSlots));
+    std::uint64_t* bits = &spikeBits[slot * denseWords];
+    std::fill_n(bits, denseWords, 0);
+    for (const auto &spike : pendingSpikes) {
+        bits[spike.neuronIndex / 64] |= std::uint64_t{1} << (spike.neuronIndex % 64);
+    }
+    denseSlotTick[slot] = tick;
+    denseLastArrival = std::max(denseLastArrival, tick + denseOffsets.front());
+    ++stats.denseDeliverySteps;
+}
+
+void NetworkManager::deliverDenseSpikes(long long emissionTick, std::size_t offset) {
+    const std::uint64_t* bits = &spikeBits[static_cast<std::size_t>(emissionTick % static_cast<long long>(denseSlots)) * denseWords];
+    const double spikeTime = emissionTick * timeStep;
+    // Solo los grupos de este retardo, en orden de neurona pre como los bits del paso
+    for (std::size_t k = denseOffsetBegin[offset]; k < denseOffsetBegin[offset + 1]; ++k) {
+        const DenseBucket &entry = denseBuckets[k];
+        if ((bits[entry.pre / 64] >> (entry.pre % 64)) & 1) {
+            bucketDeliveries.push_back(BucketDelivery{entry.bucket, entry.pre, spikeTime + bucketDelay[entry.bucket]});
+        }
+    }
+}
+
+void NetworkManager::spillDenseSpikes() {
+    if (denseLastArrival < currentTick) {
+        denseLastArrival = -1;
+        return;
+    }
+    // Mismos eventos que habría creado propagatePendingSpikes, solo para las llegadas pendientes
+    const double dt = timeStep;
+    stagedEvents.clear();
+    for (long long tick = currentTick - static_cast<long long>(denseSlots); tick < currentTick; ++tick) {
+        if (tick < 0 || denseSlotTick[static_cast<std::size_t>(tick % static_cast<long long>(denseSlots))] != tick) {
+            continue;
+        }
+        const std::uint64_t* bits = &spikeBits[static_cast<std::size_t>(tick % static_cast<long long>(denseSlots)) * denseWords];
+        for (std::size_t w = 0; w < denseWords; ++w) {
+            for (std::uint64_t word = bits[w]; word != 0; word &= word - 1) {
+                const std::size_t pre = w * 64 + static_cast<std::size_t>(__builtin_ctzll(word));
+                for (std::size_t b = axonBucketBegin[pre]; b < axonBucketEnd[pre]; ++b) {
+                    if (tick + bucketSteps[b] >= currentTick && bucketSynapseBegin[b] != bucketSynapseEnd[b]) {
+                        stagedEvents.emplace_back(tick * dt + bucketDelay[b], bucketDelay[b],
+                                                  static_cast<std::uint32_t>(pre));
+                    }
+                }
+            }
+        }
+    }
+    eventManager.pushEvents(stagedEvents);
+    std::fill(denseSlotTick.begin(), denseSlotTick.end(), -1);
+    denseLastArrival = -1;
+}
+
+void NetworkManager::applyPostSynapticPlasticity(double currentTime) {
+    fanOutOffsets.assign(firedThisStep.size() + 1, 0);
+    for (std::size_t k = 0; k < firedThisStep.size(); ++k) {
+        fanOutOffsets[k + 1] = fanOutOffsets[k] + neurons[firedThisStep[k]]->getIncomingSynapses().size();
+    }
+    const std::size_t total = fanOutOffsets.back();
+
+    withRecording(activeRecorder, [&](auto record) {
+        if (!useChunkedFanOut(total)) {
+            for (std::size_t i : firedThisStep) {
+                auto &neuron = neurons[i];
+                for (auto &synapse : neuron->getIncomingSynapses()) {
+                    applyPlasticity<decltype(record)::value>(activeRecorder, *synapse, currentTime, [&] {
+                        synapse->deliverSpikeFromPost(neuron, currentTime);
+                    });
+                }
+            }
+            return;
+        }
+
+        // Cada sinapsis pertenece a una sola lista entrante: los trozos no comparten estado
+        const std::size_t chunkSize = parallelConfig.fanOutChunkSize;
+        const std::size_t numChunks = (total + chunkSize - 1) / chunkSize;
+        scheduler->parallelFor(numChunks, [&](std::size_t worker, std::size_t chunk) {
+            (void)worker;
+            BNN_PROFILE_SCOPE(profiler, worker + 1, SimulationPhase::Plasticity, currentTick);
+            HardwareCounterScope counters(hardwareCounters.get(), worker + 1, SimulationPhase::Plasticity);
+            const std::size_t begin = chunk * chunkSize;
+            const std::size_t end = std::min(total, begin + chunkSize);
+            std::size_t k = static_cast<std::size_t>(
+                std::upper_bound(fanOutOffsets.begin(), fanOutOffsets.end(), begin) - fanOutOffsets.begin() - 1);
+            for (std::size_t pos = begin; pos < end; ++pos) {
+                while (pos >= fanOutOffsets[k + 1]) {
+                    ++k;
+                }
+                const auto &neuron = neurons[firedThisStep[k]];
+                const auto &synapse = neuron->getIncomingSynapses()[pos - fanOutOffsets[k]];
+                applyPlasticity<decltype(record)::value>(activeRecorder, *synapse, currentTime, [&] {
+                    synapse->deliverSpikeFromPost(neuron, currentTime);
+                });
+            }
+        });
+    });
+}
+
+void NetworkManager::resizeProceduralRing() {
+    if (proceduralProjections.empty()) {
+        return;
+    }
+    double maxDelay = 0.0;
+    for (const auto &projection : proceduralProjections) {
+        maxDelay = std::max(maxDelay, projection.getConfig().maxDelay);
+    }
+    const std::size_t n = neurons.size();
+    const std::size_t required = static_cast<std::size_t>(std::ceil(maxDelay / timeStep - 1e-9)) + 1;
+    if (required <= proceduralSlots && proceduralRing.size() == proceduralSlots * n) {
+        return;
+    }
+
+    // Conservar la corriente pendiente en la ranura de su paso de llegada
+    const std::size_t newSlots = std::max(required, proceduralSlots);
+    const std::size_t oldN = proceduralSlots > 0 ? proceduralRing.size() / proceduralSlots : 0;
+    std::vector<double> ring(newSlots * n, 0.0);
+    for (std::size_t offset = 0; offset < proceduralSlots; ++offset) {
+        const long long tick = currentTick + static_cast<long long>(offset);
+        const std::size_t oldSlot = static_cast<std::size_t>(tick % static_cast<long long>(proceduralSlots));
+        const std::size_t newSlot = static_cast<std::size_t>(tick % static_cast<long long>(newSlots));
+        std::copy_n(proceduralRing.begin() + oldSlot * oldN, std::min(oldN, n), ring.begin() + newSlot * n);
+    }
+    proceduralRing = std::move(ring);
+    proceduralSlots = newSlots;
+}
+
+void NetworkManager::propagateProcedural() {
+    if (proceduralProjections.empty()) {
+        return;
+    }
+    const double dt = timeStep;
+    const std::size_t n = neurons.size();
+    const long long slots = static_cast<long long>(proceduralSlots);
+
+    for (const auto &spike : pendingSpikes) {
+        for (const auto &projection : proceduralProjections) {
+            projection.forEachTarget(spike.neuronIndex, [&](std::size_t post, double weight, double delay) {
+                if (!isLocalNeuron(post)) {
+                    return;
+                }
+                // Mismo paso de entrega que un SpikeEvent con tiempo tick * dt + delay
+                const long long arrival = spike.tick + static_cast<long long>(std::ceil(delay / dt - 1e-9));
+                proceduralRing[static_cast<std::size_t>(arrival % slots) * n + post] += weight;
+                proceduralLastArrival = std::max(proceduralLastArrival, arrival);
+                ++stats.synapticEvents;
+            });
+        }
+    }
+}
+
+void NetworkManager::deliverProceduralCurrents(std::size_t begin, std::size_t end, long long tick) {
+    if (proceduralProjections.empty()) {
+        return;
+    }
+    const std::size_t n = neurons.size();
+    double* slot = &proceduralRing[static_cast<std::size_t>(tick % static_cast<long long>(proceduralSlots)) * n];
+    for (std::size_t i = begin; i < end; ++i) {
+        if (slot[i] != 0.0) {
+            neurons[i]->injectCurrent(slot[i]);
+            slot[i] = 0.0;
+        }
+    }
+}
+
+namespace {
+
+    // Orden canónico (paso, índice) para que la cola reciba los eventos como en un solo proceso
+    void sortSpikes(std::vector<RemoteSpike>& spikes) {
+        std::sort(spikes.begin(), spikes.end(), [](const RemoteSpike& a, const RemoteSpike& b) {
+            return a.tick != b.tick ? a.tick < b.tick : a.neuronIndex < b.neuronIndex;
+        });
+    }
+
+}
+
+void NetworkManager::flushSpikeWindow() {
+    const double dt = timeStep;
+
+    if (transport) {
+        transport->exchange(pendingSpikes, remoteSpikes);
+        sortSpikes(remoteSpikes);
+        for (const auto &spike : remoteSpikes) {
+            neurons[spike.neuronIndex]->setLastSpikeTime(spike.tick * dt);
+        }
+        pendingSpikes.insert(pendingSpikes.end(), remoteSpikes.begin(), remoteSpikes.end());
+        sortSpikes(pendingSpikes);
+    }
+
+    propagateWindowSpikes();
+}
+
+void NetworkManager::propagateWindowSpikes() {
+    propagatePendingSpikes();
+    propagateProcedural();
+
+    pendingSpikes.clear();
+    stepsInWindow = 0;
+}
+
+void NetworkManager::integrateRange(std::size_t begin, std::size_t end, std::vector<std::size_t>& fired,
+                                    long long tick, std::size_t threadSlot)
+{
+    if (!stepMultiples.empty()) {
+        integrateMultiRateRange(begin, end, fired, tick, threadSlot);
+        return;
+    }
+    const double dt = timeStep;
+    const double currentTime = tick * dt;
+
+    {
+        BNN_PROFILE_SCOPE(profiler, threadSlot, SimulationPhase::CurrentInjection, tick);
+        for (std::size_t i = begin; i < end; ++i) {
+            if (isLocalNeuron(i)) {
+                neurons[i]->injectCurrent(backgroundCurrent + externalCurrents[i]);
+            }
+            externalCurrents[i] = 0.0;
+        }
+    }
+
+    BNN_PROFILE_SCOPE(profiler, threadSlot, SimulationPhase::Integration, tick);
+    HardwareCounterScope counters(hardwareCounters.get(), threadSlot, SimulationPhase::Integration);
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!isLocalNeuron(i)) {
+            continue;
+        }
+        auto &neuron = neurons[i];
+        neuron->stepSimulation(dt, currentTime);
+        if (neuron->hasFired()) {
+            fired.push_back(i);
+        }
+    }
+}
+
+void NetworkManager::integrateMultiRateRange(std::size_t begin, std::size_t end, std::vector<std::size_t>& fired,
+                                             long long tick, std::size_t threadSlot)
+{
+    const double dt = timeStep;
+    const double currentTime = tick * dt;
+    // Solo las neuronas cuya ventana termina en este paso; el resto acumula entrada
+    auto closesWindow = [&](std::size_t i) { return (tick + 1) % stepMultiples[i] == 0; };
+
+    {
+        BNN_PROFILE_SCOPE(profiler, threadSlot, SimulationPhase::CurrentInjection, tick);
+        for (std::size_t i = begin; i < end; ++i) {
+            if (!closesWindow(i)) {
+                continue;
+            }
+            if (isLocalNeuron(i)) {
+                // La entrada externa y la sináptica instantánea de los k pasos base se
+                // promedian: integradas con k * dt aportan la misma carga que con dt
+                neurons[i]->injectCurrent(externalCurrents[i]);
+                neurons[i]->scaleAccumulatedCurrent(1.0 / stepMultiples[i]);
+                neurons[i]->injectCurrent(backgroundCurrent);
+            }
+            externalCurrents[i] = 0.0;
+        }
+    }
+
+    BNN_PROFILE_SCOPE(profiler, threadSlot, SimulationPhase::Integration, tick);
+    HardwareCounterScope counters(hardwareCounters.get(), threadSlot, SimulationPhase::Integration);
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!isLocalNeuron(i) || !closesWindow(i)) {
+            continue;
+        }
+        const int multiple = stepMultiples[i];
+        auto &neuron = neurons[i];
+        neuron->stepSimulation(multiple * dt, currentTime - (multiple - 1) * dt);
+        if (neuron->hasFired()) {
+            // El spike se emite en este paso base: ese es también su tiempo registrado
+            neuron->setLastSpikeTime(currentTime);
+            fired.push_back(i);
+        }
+    }
+}
+
+void NetworkManager::stepOnce() {
+    const double dt = timeStep;
+    const double currentTime = currentTick * dt;
+
+    // 1. Integración de las neuronas locales (por particiones si hay hilos)
+    firedThisStep.clear();
+    if (threadPool) {
+        threadPool->runOnAll([&](std::size_t w) {
+            partitionFired[w].clear();
+            integrateRange(partitionBounds[w], partitionBounds[w + 1], partitionFired[w], currentTick, w + 1);
+        });
+        ++stats.threadSynchronizations;
+        for (const auto &fired : partitionFired) {
+            firedThisStep.insert(firedThisStep.end(), fired.begin(), fired.end());
+        }
+    } else {
+        integrateRange(0, neurons.size(), firedThisStep, currentTick, 0);
+    }
+    if (activeRecorder) {
+        firedSpikeTimes.clear();
+        for (std::size_t i : firedThisStep) {
+            firedSpikeTimes.push_back(neurons[i]->getLastSpikeTime());
+        }
+    }
+    commitFiredSpikes(currentTime);
+
+    // 2. Propagación al cerrar la ventana de retardo mínimo
+    if (++stepsInWindow >= windowSteps) {
+        BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::SpikeEmission, currentTick);
+        HardwareCounterScope counters(hardwareCounters.get(), 0, SimulationPhase::SpikeEmission);
+        flushSpikeWindow();
+    }
+
+    // 3. STDP por el lado post-sináptico
+    for (std::size_t i : firedThisStep) {
+        recentSpikes.push_back(EmittedSpike{i, currentTick});
+    }
+    {
+        BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::Plasticity, currentTick);
+        HardwareCounterScope counters(hardwareCounters.get(), 0, SimulationPhase::Plasticity);
+        applyPostSynapticPlasticity(currentTime);
+    }
+
+    // 4. Entrega de los eventos que llegan en este paso
+    BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::EventDelivery, currentTick);
+    HardwareCounterScope counters(hardwareCounters.get(), 0, SimulationPhase::EventDelivery);
+    // Los spikes del bitset se intercalan con los eventos por paso de emisión
+    const bool denseDue = denseLastArrival >= currentTick;
+    std::size_t nextOffset = 0;
+    auto deliverDenseBefore = [&](long long emissionLimit) {
+        for (; nextOffset < denseOffsets.size(); ++nextOffset) {
+            const long long emission = currentTick - denseOffsets[nextOffset];
+            if (emission >= emissionLimit) {
+                return;
+            }
+            if (emission >= 0 &&
+                denseSlotTick[static_cast<std::size_t>(emission % static_cast<long long>(denseSlots))] == emission) {
+                deliverDenseSpikes(emission, nextOffset);
+            }
+        }
+    };
+    bucketDeliveries.clear();
+    while (!eventManager.empty() && eventManager.nextEventTime() <= currentTime) {
+        const AxonEvent e = eventManager.popEvent();
+        if (denseDue) {
+            deliverDenseBefore(std::llround((e.time - e.delay) / dt));
+        }
+        const std::size_t b = findAxonBucket(e);
+        if (b != bucketDelay.size()) {
+            bucketDeliveries.push_back(BucketDelivery{b, e.neuronIndex, e.time});
+        }
+    }
+    if (denseDue) {
+        deliverDenseBefore(std::numeric_limits<long long>::max());
+    }
+    deliverAxonBuckets();
+    deliverProceduralCurrents(0, neurons.size(), currentTick);
+}
+
+void NetworkManager::commitFiredSpikes(double currentTime) {
+    if (activeRecorder) {
+        for (std::size_t k = 0; k < firedThisStep.size(); ++k) {
+            activeRecorder->recordSpike(neurons[firedThisStep[k]]->getID(), firedSpikeTimes[k]);
+        }
+    }
+    for (std::size_t i : firedThisStep) {
+        neurons[i]->setLastSpikeTime(currentTime);
+        pendingSpikes.push_back(RemoteSpike{currentTick, static_cast<std::uint32_t>(i), 0});
+    }
+    if (populationStatistics) {
+        for (std::size_t i : firedThisStep) {
+            populationStatistics->recordSpike(i < originalIndices.size() ? originalIndices[i] : i, currentTime);
+        }
+        populationStatistics->advanceTo(currentTime + timeStep);
+    }
+}
+
+void NetworkManager::deliverAxonBuckets() {
+    std::size_t total = 0;
+    for (const auto &delivery : bucketDeliveries) {
+        total += bucketSynapseEnd[delivery.bucket] - bucketSynapseBegin[delivery.bucket];
+    }
+    stats.synapticEvents += total;
+
+    if (!useChunkedFanOut(total)) {
+        withRecording(activeRecorder, [&](auto record) {
+            for (const auto &delivery : bucketDeliveries) {
+                const auto &pre = neurons[delivery.pre];
+                for (std::size_t k = bucketSynapseBegin[delivery.bucket]; k < bucketSynapseEnd[delivery.bucket]; ++k) {
+                    applyPlasticity<decltype(record)::value>(activeRecorder, *axonSynapses[k], delivery.time, [&] {
+                        axonSynapses[k]->deliverSpikeFromPre(pre, delivery.time);
+                    });
+                }
+            }
+        });
+        return;
+    }
+
+    // Cada trozo es un rango de neuronas post: entrega, en el orden de la cola, las
+    // sinapsis de cada grupo que llegan a su rango (un tramo contiguo del grupo), de
+    // modo que cada neurona post recibe su entrada en el mismo orden que en serie y
+    // cada sinapsis la actualiza un solo hilo. Los límites salen del grupo más grande
+    // cortado cada fanOutChunkSize sinapsis, o de las particiones si ninguno llega a dos trozos
+    const std::size_t workers = threadPool->size();
+    std::size_t largest = bucketDeliveries.front().bucket;
+    for (const auto &delivery : bucketDeliveries) {
+        if (bucketSynapseEnd[delivery.bucket] - bucketSynapseBegin[delivery.bucket] >
+            bucketSynapseEnd[largest] - bucketSynapseBegin[largest]) {
+            largest = delivery.bucket;
+        }
+    }
+    const std::size_t largestSize = bucketSynapseEnd[largest] - bucketSynapseBegin[largest];
+    deliveryChunkBounds.clear();
+    if (largestSize >= 2 * parallelConfig.fanOutChunkSize) {
+        // Como mucho 16 trozos por hilo: cada trozo busca su tramo en todos los grupos
+        const std::size_t stride = std::max(parallelConfig.fanOutChunkSize,
+                                            (largestSize + 16 * workers - 1) / (16 * workers));
+        deliveryChunkBounds.push_back(0);
+        for (std::size_t k = bucketSynapseBegin[largest] + stride; k < bucketSynapseEnd[largest]; k += stride) {
+            if (axonSynapsePost[k] > deliveryChunkBounds.back()) {
+                deliveryChunkBounds.push_back(axonSynapsePost[k]);
+            }
+        }
+        deliveryChunkBounds.push_back(neurons.size());
+    } else {
+        deliveryChunkBounds.assign(partitionBounds.begin(), partitionBounds.end());
+    }
+    stats.deliveryChunksByWorker.resize(workers, 0);
+
+    withRecording(activeRecorder, [&](auto record) {
+        scheduler->parallelFor(deliveryChunkBounds.size() - 1, [&](std::size_t worker, std::size_t chunk) {
+            BNN_PROFILE_SCOPE(profiler, worker + 1, SimulationPhase::EventDelivery, currentTick);
+            HardwareCounterScope counters(hardwareCounters.get(), worker + 1, SimulationPhase::EventDelivery);
+            ++stats.deliveryChunksByWorker[worker];
+            const auto low = static_cast<std::uint32_t>(deliveryChunkBounds[chunk]);
+            const auto high = static_cast<std::uint32_t>(deliveryChunkBounds[chunk + 1]);
+            const auto posts = axonSynapsePost.begin();
+            for (const auto &delivery : bucketDeliveries) {
+                const auto first = std::lower_bound(posts + bucketSynapseBegin[delivery.bucket],
+                                                    posts + bucketSynapseEnd[delivery.bucket], low);
+                const auto last = std::lower_bound(first, posts + bucketSynapseEnd[delivery.bucket], high);
+                const auto &pre = neurons[delivery.pre];
+                for (auto k = first; k != last; ++k) {
+                    ISynapse &synapse = *axonSynapses[static_cast<std::size_t>(k - posts)];
+                    applyPlasticity<decltype(record)::value>(activeRecorder, synapse, delivery.time, [&] {
+                        synapse.deliverSpikeFromPre(pre, delivery.time);
+                    });
+                }
+            }
+        });
+    });
+}
+
+std::size_t NetworkManager::findAxonBucket(const AxonEvent& event) const {
+    const auto first = bucketDelay.begin() + axonBucketBegin[event.neuronIndex];
+    const auto last = bucketDelay.begin() + axonBucketEnd[event.neuronIndex];
+    const auto bucket = std::lower_bound(first, last, event.delay);
+    // El grupo puede haber desaparecido si la conectividad cambió con el evento en vuelo
+    if (bucket == last || *bucket != event.delay) {
+        return bucketDelay.size();
+    }
+    return static_cast<std::size_t>(bucket - bucketDelay.begin());
+}
+
+void NetworkManager::runMinDelayWindow(long long endTick) {
+    const double dt = timeStep;
+    const long long firstTick = currentTick;
+    const std::size_t parts = partitionBounds.size() - 1;
+    partitionFired.resize(parts);
+    partitionDeliveries.resize(parts);
+    partitionWindowFired.resize(parts);
+    partitionWindowSpikeTimes.resize(parts);
+    windowStartSpikeTimes.resize(neurons.size());
+
+    // 1. Sinapsis que reciben eventos en la ventana, repartidas por la partición de su neurona post.
+    //    Todos estaban ya en la cola: los spikes de la ventana no llegan antes de endTick
+    windowDeliveries.clear();
+    for (auto &deliveries : partitionDeliveries) {
+        deliveries.clear();
+    }
+    {
+        BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::EventDelivery, firstTick);
+        for (long long tick = firstTick; tick < endTick; ++tick) {
+            while (!eventManager.empty() && eventManager.nextEventTime() <= tick * dt) {
+                const AxonEvent e = eventManager.popEvent();
+                const std::size_t b = findAxonBucket(e);
+                if (b == bucketDelay.size()) {
+                    continue;
+                }
+                for (std::size_t k = bucketSynapseBegin[b]; k < bucketSynapseEnd[b]; ++k) {
+                    const auto owner = std::upper_bound(partitionBounds.begin(), partitionBounds.end(),
+                                                        axonSynapsePost[k]) - partitionBounds.begin() - 1;
+                    partitionDeliveries[static_cast<std::size_t>(owner)].push_back(windowDeliveries.size());
+                    windowDeliveries.push_back(WindowDelivery{tick, k, e.neuronIndex, e.time});
+                }
+            }
+        }
+    }
+
+    // 2. Cada hilo avanza su partición toda la ventana: integración y corriente de
+    //    los eventos que llegan a sus neuronas. Sin STDP no lee estado de otras particiones
+    auto advancePartition = [&](std::size_t w, std::size_t threadSlot) {
+        const std::size_t begin = partitionBounds[w];
+        const std::size_t end = partitionBounds[w + 1];
+        auto &fired = partitionFired[w];
+        auto &windowFired = partitionWindowFired[w];
+        auto &spikeTimes = partitionWindowSpikeTimes[w];
+        const auto &deliveries = partitionDeliveries[w];
+        windowFired.clear();
+        spikeTimes.clear();
+        for (std::size_t i = begin; i < end; ++i) {
+            windowStartSpikeTimes[i] = neurons[i]->getLastSpikeTime();
+        }
+
+        std::size_t next = 0;
+        for (long long tick = firstTick; tick < endTick; ++tick) {
+            fired.clear();
+            integrateRange(begin, end, fired, tick, threadSlot);
+            for (std::size_t i : fired) {
+                if (activeRecorder) {
+                    spikeTimes.push_back(neurons[i]->getLastSpikeTime());
+                }
+                neurons[i]->setLastSpikeTime(tick * dt);
+                windowFired.push_back(EmittedSpike{i, tick});
+            }
+
+            BNN_PROFILE_SCOPE(profiler, threadSlot, SimulationPhase::EventDelivery, tick);
+            for (; next < deliveries.size() && windowDeliveries[deliveries[next]].tick == tick; ++next) {
+                const WindowDelivery &d = windowDeliveries[deliveries[next]];
+                axonSynapses[d.synapse]->transmitFromPre(neurons[d.pre]);
+            }
+            deliverProceduralCurrents(begin, end, tick);
+        }
+    };
+    if (threadPool) {
+        threadPool->runOnAll([&](std::size_t w) { advancePartition(w, w + 1); });
+        ++stats.threadSynchronizations;
+    } else {
+        advancePartition(0, 0);
+    }
+
+    // 3. STDP en el orden paso a paso: se rehacen los tiempos de disparo de cada paso
+    //    a partir de los del inicio de la ventana. En modo distribuido los spikes de
+    //    los demás ranks se reciben antes, para que el STDP vea sus pasos reales
+    if (transport) {
+        windowLocalSpikes.clear();
+        for (const auto &windowFired : partitionWindowFired) {
+            for (const auto &spike : windowFired) {
+                windowLocalSpikes.push_back(
+                    RemoteSpike{spike.tick, static_cast<std::uint32_t>(spike.neuronIndex), 0});
+            }
+        }
+        transport->exchange(windowLocalSpikes, remoteSpikes);
+        sortSpikes(remoteSpikes);
+    }
+    for (const auto &windowFired : partitionWindowFired) {
+        for (const auto &spike : windowFired) {
+            neurons[spike.neuronIndex]->setLastSpikeTime(windowStartSpikeTimes[spike.neuronIndex]);
+        }
+    }
+    std::vector<std::size_t> cursor(parts, 0);
+    std::size_t nextDelivery = 0;
+    std::size_t nextRemote = 0;
+    for (long long tick = firstTick; tick < endTick; ++tick) {
+        currentTick = tick;
+        const double currentTime = tick * dt;
+        firedThisStep.clear();
+        firedSpikeTimes.clear();
+        for (std::size_t w = 0; w < parts; ++w) {
+            const auto &windowFired = partitionWindowFired[w];
+            for (; cursor[w] < windowFired.size() && windowFired[cursor[w]].tick == tick; ++cursor[w]) {
+                firedThisStep.push_back(windowFired[cursor[w]].neuronIndex);
+                if (activeRecorder) {
+                    firedSpikeTimes.push_back(partitionWindowSpikeTimes[w][cursor[w]]);
+                }
+            }
+        }
+        commitFiredSpikes(currentTime);
+        for (std::size_t i : firedThisStep) {
+            recentSpikes.push_back(EmittedSpike{i, tick});
+        }
+        if (transport) {
+            for (; nextRemote < remoteSpikes.size() && remoteSpikes[nextRemote].tick == tick; ++nextRemote) {
+                neurons[remoteSpikes[nextRemote].neuronIndex]->setLastSpikeTime(currentTime);
+                pendingSpikes.push_back(remoteSpikes[nextRemote]);
+            }
+        }
+
+        BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::Plasticity, tick);
+        HardwareCounterScope counters(hardwareCounters.get(), 0, SimulationPhase::Plasticity);
+        applyPostSynapticPlasticity(currentTime);
+        withRecording(activeRecorder, [&](auto record) {
+            for (; nextDelivery < windowDeliveries.size() && windowDeliveries[nextDelivery].tick == tick; ++nextDelivery) {
+                const WindowDelivery &d = windowDeliveries[nextDelivery];
+                applyPlasticity<decltype(record)::value>(activeRecorder, *axonSynapses[d.synapse], d.time, [&] {
+                    axonSynapses[d.synapse]->applyPrePlasticity(neurons[d.pre], d.time);
+                });
+            }
+        });
+    }
+    stats.synapticEvents += windowDeliveries.size();
+
+    // 4. Propagación de todos los spikes de la ventana, ya intercambiados
+    BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::SpikeEmission, currentTick);
+    HardwareCounterScope counters(hardwareCounters.get(), 0, SimulationPhase::SpikeEmission);
+    if (transport) {
+        sortSpikes(pendingSpikes);
+    }
+    propagateWindowSpikes();
+}
+
+void NetworkManager::setQuiescentSkipping(bool enable, double tolerance) {
+    if (tolerance < 0.0) {
+        throw std::invalid_argument("La tolerancia de reposo no puede ser negativa.");
+    }
+    quiescentSkipping = enable;
+    quiescentTolerance = tolerance;
+}
+
+std::size_t NetworkManager::addProbe(const ProbeConfig& config) {
+    if (config.variable == ProbeVariable::SynapticWeight) {
+        for (const auto &target : config.synapses) {
+            if (target.first >= neurons.size() || target.second >= neurons.size()) {
+                throw std::out_of_range("La sonda referencia neuronas inexistentes.");
+            }
+        }
+    } else {
+        for (std::size_t target : config.neurons) {
+            if (target >= neurons.size()) {
+                throw std::out_of_range("La sonda referencia neuronas inexistentes.");
+            }
+        }
+    }
+    probes.push_back(std::make_unique<StateProbe>(config, timeStep, currentTick));
+    try {
+        bindProbes();
+    } catch (...) {
+        probes.pop_back();
+        throw;
+    }
+    return probes.size() - 1;
+}
+
+StateProbe& NetworkManager::getProbe(std::size_t id) {
+    if (id >= probes.size()) {
+        throw std::out_of_range("Sonda inexistente.");
+    }
+    return *probes[id];
+}
+
+void NetworkManager::flushProbes() {
+    for (auto &probe : probes) {
+        probe->flush();
+    }
+}
+
+void NetworkManager::bindProbes() {
+    for (auto &probe : probes) {
+        const ProbeConfig &config = probe->getConfig();
+        if (config.variable != ProbeVariable::SynapticWeight) {
+            std::vector<const INeuron*> targets;
+            targets.reserve(config.neurons.size());
+            for (std::size_t index : config.neurons) {
+                targets.push_back(neurons.at(index).get());
+            }
+            probe->bindNeurons(std::move(targets));
+            continue;
+        }
+        // Primera sinapsis pre -> post; nula si se ha podado
+        std::vector<const ISynapse*> targets;
+        targets.reserve(config.synapses.size());
+        for (const auto &target : config.synapses) {
+            targets.push_back(findSynapse(target.first, target.second));
+        }
+        probe->bindSynapses(std::move(targets));
+    }
+}
+
+long long NetworkManager::nextProbeTick() const {
+    long long next = std::numeric_limits<long long>::max();
+    for (const auto &probe : probes) {
+        next = std::min(next, probe->getNextSampleTick());
+    }
+    return next;
+}
+
+void NetworkManager::enableStructuralPlasticity(const StructuralPlasticityConfig& config) {
+    if (transport) {
+        throw std::logic_error("La plasticidad estructural no admite el modo distribuido.");
+    }
+    if (config.reviewInterval <= 0.0 || config.pruneAfter < 0.0) {
+        throw std::invalid_argument("El intervalo de revisión debe ser positivo y el tiempo de poda no negativo.");
+    }
+    if (config.growthProbability < 0.0 || config.growthProbability > 1.0 || config.growthDelay <= 0.0) {
+        throw std::invalid_argument("Probabilidad de crecimiento o retardo de las sinapsis nuevas no válidos.");
+    }
+    structuralPlasticity = true;
+    structuralConfig = config;
+    structuralRng.seed(config.seed);
+    lastStructuralReview = getCurrentTime();
+    nextStructuralReview = currentTick + reviewSteps();
+}
+
+long long NetworkManager::reviewSteps() const {
+    return std::max(1LL, static_cast<long long>(std::llround(structuralConfig.reviewInterval / timeStep)));
+}
+
+void NetworkManager::applyStructuralPlasticity() {
+    const double now = getCurrentTime();
+    nextStructuralReview = currentTick + reviewSteps();
+    bool changed = false;
+
+    // 1. Poda de las sinapsis que llevan pruneAfter ms en su peso mínimo
+    std::unordered_set<const ISynapse*> pruned;
+    std::vector<INeuron*> touched;
+    std::vector<std::size_t> prunedPres;
+    for (const auto &synapse : synapses) {
+        const double since = synapse->weightFloorSince(now);
+        if (!std::isnan(since) && now - since >= structuralConfig.pruneAfter) {
+            pruned.insert(synapse.get());
+            touched.push_back(synapse->getPreNeuron().get());
+            touched.push_back(synapse->getPostNeuron().get());
+            auto pre = neuronIndices.find(synapse->getPreNeuron().get());
+            if (pre != neuronIndices.end()) {
+                prunedPres.push_back(pre->second);
+            }
+        }
+    }
+    if (!pruned.empty()) {
+        // Solo se compactan las listas de las neuronas afectadas
+        std::sort(touched.begin(), touched.end());
+        touched.erase(std::unique(touched.begin(), touched.end()), touched.end());
+        auto isPruned = [&](const ISynapse& synapse) { return pruned.count(&synapse) > 0; };
+        for (INeuron* neuron : touched) {
+            neuron->removeSynapsesIf(isPruned);
+        }
+        if (synapseIndexEnabled) {
+            // Solo cambian los pares podados: otra sinapsis del mismo par pasa a ser la primera
+            for (const ISynapse* synapse : pruned) {
+                auto pre = neuronIndices.find(synapse->getPreNeuron().get());
+                auto post = neuronIndices.find(synapse->getPostNeuron().get());
+                if (pre == neuronIndices.end() || post == neuronIndices.end()) {
+                    continue;
+                }
+                const auto preIndex = static_cast<std::uint32_t>(pre->second);
+                const auto postIndex = static_cast<std::uint32_t>(post->second);
+                ISynapse** entry = synapseIndex.find(preIndex, postIndex);
+                if (!entry || *entry != synapse) {
+                    continue;
+                }
+                synapseIndex.erase(preIndex, postIndex);
+                for (const auto &remaining : neurons[pre->second]->getOutgoingSynapses()) {
+                    if (remaining->getPostNeuron().get() == post->first) {
+                        synapseIndex.insert(preIndex, postIndex, remaining.get());
+                        break;
+                    }
+                }
+            }
+        }
+        if (!axonIndexDirty) {
+            std::sort(prunedPres.begin(), prunedPres.end());
+            prunedPres.erase(std::unique(prunedPres.begin(), prunedPres.end()), prunedPres.end());
+            removeAxonSynapses(prunedPres, pruned);
+        }
+        synapses.erase(std::remove_if(synapses.begin(), synapses.end(),
+                                      [&](const std::shared_ptr<ISynapse>& synapse) { return isPruned(*synapse); }),
+                       synapses.end());
+        stats.prunedSynapses += pruned.size();
+        changed = true;
+    }
+
+    // 2. Crecimiento desde las neuronas que dispararon desde la revisión anterior
+    const std::size_t n = neurons.size();
+    if (structuralConfig.growthProbability > 0.0 && n > 1) {
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+        std::uniform_int_distribution<std::size_t> pick(0, n - 2);
+        for (std::size_t i = 0; i < n; ++i) {
+            const double lastSpike = neurons[i]->getLastSpikeTime();
+            if (lastSpike < 0.0 || lastSpike < lastStructuralReview) {
+                continue;
+            }
+            // Signo configurado o, en su defecto, el de sus sinapsis salientes
+            const std::size_t original = i < originalIndices.size() ? originalIndices[i] : i;
+            const auto &outgoing = neurons[i]->getOutgoingSynapses();
+            bool inhibitory = false;
+            if (original < structuralConfig.inhibitoryNeurons.size()) {
+                inhibitory = structuralConfig.inhibitoryNeurons[original];
+            } else if (!outgoing.empty()) {
+                inhibitory = dynamic_cast<const InhibitorySynapse*>(outgoing.front().get()) != nullptr;
+            } else {
+                continue;
+            }
+            if (chance(structuralRng) >= structuralConfig.growthProbability) {
+                continue;
+            }
+            std::size_t target = pick(structuralRng);
+            if (target >= i) {
+                ++target;
+            }
+            if (isConnected(i, target)) {
+                continue;
+            }
+            // Sin pasar por acceptsConnection: la red conserva su colocación en memoria
+            std::shared_ptr<ISynapse> synapse;
+            if (inhibitory) {
+                synapse = std::make_shared<InhibitorySynapse>(neurons[i], neurons[target], structuralConfig.growthWeight,
+                                                              structuralConfig.growthDelay);
+            } else {
+                synapse = std::make_shared<ExcitatorySynapse>(neurons[i], neurons[target], structuralConfig.growthWeight,
+                                                              structuralConfig.growthDelay);
+            }
+            addSynapse(synapse);
+            neurons[i]->addOutgoingSynapse(synapse);
+            neurons[target]->addIncomingSynapse(synapse);
+            if (!axonIndexDirty) {
+                insertAxonSynapse(i, target, synapse.get());
+            }
+            ++stats.grownSynapses;
+            changed = true;
+        }
+    }
+    lastStructuralReview = now;
+
+    // Los eventos en vuelo guardan su retardo: se entregan a las sinapsis actuales de su grupo.
+    // El índice solo se reconstruye cuando los huecos superan a las posiciones en uso
+    if (changed) {
+        updateExchangeWindow();
+        if (axonIndexDirty || deadAxonSynapses > axonSynapses.size() / 2 || deadAxonBuckets > bucketDelay.size() / 2) {
+            rebuildAxonIndex();
+        }
+        if (denseBucketsDirty) {
+            rebuildDenseBuckets();
+        }
+        bindProbes();
+    }
+}
+
+long long NetworkManager::skipQuiescentSteps(long long untilTick) {
+    const std::size_t n = neurons.size();
+    if (transport || n == 0 || !eventManager.empty() || !pendingSpikes.empty() ||
+        proceduralLastArrival >= currentTick || denseLastArrival >= currentTick) {
+        return 0;
+    }
+
+    const double dt = timeStep;
+    // Cada neurona se consulta y avanza con su propio paso (múltiplo k del base)
+    auto multipleOf = [&](std::size_t i) { return stepMultiples.empty() ? 1LL : stepMultiples[i]; };
+    auto horizonOf = [&](std::size_t i) {
+        const long long k = multipleOf(i);
+        return externalCurrents[i] != 0.0
+            ? 0LL
+            : k * neurons[i]->quiescentHorizon((untilTick - currentTick) / k, k * dt, backgroundCurrent,
+                                               quiescentTolerance);
+    };
+
+    // La neurona que bloqueó el último intento suele seguir bloqueando: descarte en O(1)
+    quiescentBlocker %= n;
+    long long steps = horizonOf(quiescentBlocker);
+    for (std::size_t i = 0; i < n && steps > 0; ++i) {
+        const long long horizon = horizonOf(i);
+        if (horizon < steps) {
+            steps = horizon;
+            quiescentBlocker = i;
+        }
+    }
+    // Con varios pasos de integración, saltar un múltiplo común conserva la fase de cada ventana
+    steps -= steps % stepMultipleLcm;
+    if (steps <= 0) {
+        return 0;
+    }
+
+    // steps es múltiplo de todos los k: cada neurona cierra exactamente steps / k ventanas
+    for (std::size_t i = 0; i < n; ++i) {
+        const long long k = multipleOf(i);
+        neurons[i]->skipQuiescent(steps / k, k * dt, backgroundCurrent);
+    }
+    currentTick += steps;
+    if (populationStatistics) {
+        populationStatistics->advanceTo(currentTick * dt);
+    }
+    return steps;
+}
+
+void NetworkManager::runSimulation(double tMax, double dt) {
+    setTimeStep(dt);
+    long long steps = static_cast<long long>(tMax / dt);
+    advance(currentTick + steps);
+    flushRecorders();
+
+    if (!exportLogsOnFinish || !logger) {
+        return;
+    }
+    BNN_PROFILE_SCOPE(profiler, 0, SimulationPhase::LoggerIO, currentTick);
+    try {
+        // Con escritura en segundo plano los ficheros ya están escritos
+        if (logger->isStreaming()) {
+            logger->flushStreaming();
+            return;
+        }
+        logger->exportSpikesToCSV("output_logs/spikes.csv");
+        logger->exportWeightChangesToCSV("output_logs/weight_changes.csv");
+        logger->exportLogsToText("output_logs/simulation_logs.txt");
+        std::cout << "Logs exportados exitosamente.\n";
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error al exportar logs: " << e.what() << "\n";
+    }
+}
+
+void NetworkManager::createNetwork(const NetworkConfig& config) {
+    // 1. Crear neuronas excitatorias
+    int numExcitatory = static_cast<int>(config.totalNeurons * config.excitatoryRatio);
+    int numInhibitory = static_cast<int>(config.totalNeurons * config.inhibitoryRatio);
+
+    for (int i = 0; i < numExcitatory; ++i) {
+        createNeuron(NeuronType::Izhikevich,
+                     {0.02, 0.2, -65.0, 8.0, 30.0, -65.0, 1.0, 1.0, 2.0});
+    }
+
+    for (int i = 0; i < numInhibitory; ++i) {
+        createNeuron(NeuronType::Izhikevich,
+                     {0.1, 0.2, -65.0, 2.0, 30.0, -65.0, 1.0, 1.0, 2.0});
+    }
+
+    // Con semilla fija la topología es reproducible (necesario, p. ej., en modo distribuido)
+    const bool seeded = config.seed >= 0;
+    const unsigned int excSeed = static_cast<unsigned int>(config.seed);
+    const unsigned int inhSeed = excSeed + 1;
+
     if (config.connectivityStrategy == "Random") {
         // Conectividad aleatoria excitatoria
-        auto randomStrategy = std::make_unique<RandomConnectivityStrategy>(
-            config.excitatoryConnectivity.connectionProbability,
-            config.excitatoryConnectivity.defaultWeight,
-            config.excitatoryConnectivity.excitatory
-        );
+        auto randomStrategy = seeded
+            ? std::make_unique<RandomConnectivityStrategy>(
+                  config.excitatoryConnectivity.connectionProbability,
+                  config.excitatoryConnectivity.defaultWeight,
+                  config.excitatoryConnectivity.excitatory,
+                  excSeed)
+            : std::make_unique<RandomConnectivityStrategy>(
+                  config.excitatoryConnectivity.connectionProbability,
+                  config.excitatoryConnectivity.defaultWeight,
+                  config.excitatoryConnectivity.excitatory);
         setConnectivityStrategy(std::move(randomStrategy));
         applyConnectivityStrategy();
 
-        auto randomStrategyInh = std::make_unique<RandomConnectivityStrategy>(
-            config.inhibitoryConnectivity.connectionProbability,
-            config.inhibitoryConnectivity.defaultWeight,
-            config.inhibitoryConnectivity.excitatory
-        );
+        auto randomStrategyInh = seeded
+            ? std::make_unique<RandomConnectivityStrategy>(
+                  config.inhibitoryConnectivity.connectionProbability,
+                  config.inhibitoryConnectivity.defaultWeight,
+                  config.inhibitoryConnectivity.excitatory,
+                  inhSeed)
+            : std::make_unique<RandomConnectivityStrategy>(
+                  config.inhibitoryConnectivity.connectionProbability,
+                  config.inhibitoryConnectivity.defaultWeight,
+                  config.inhibitoryConnectivity.excitatory);
         setConnectivityStrategy(std::move(randomStrategyInh));
         applyConnectivityStrategy();
     }
     else if (config.connectivityStrategy == "SmallWorld") {
-        auto smallWorldStrategy = std::make_unique<SmallWorldConnectivityStrategy>(
-            0.1,
-            10
-        );
+        auto smallWorldStrategy = seeded
+            ? std::make_unique<SmallWorldConnectivityStrategy>(0.1, 10, excSeed)
+            : std::make_unique<SmallWorldConnectivityStrategy>(0.1, 10);
         setConnectivityStrategy(std::move(smallWorldStrategy));
         applyConnectivityStrategy();
 
-        auto smallWorldStrategyInh = std::make_unique<SmallWorldConnectivityStrategy>(
-            0.1,
-            10
-        );
+        auto smallWorldStrategyInh = seeded
+            ? std::make_unique<SmallWorldConnectivityStrategy>(0.1, 10, inhSeed)
+            : std::make_unique<SmallWorldConnectivityStrategy>(0.1, 10);
         setConnectivityStrategy(std::move(smallWorldStrategyInh));
         applyConnectivityStrategy();
     }
     else if (config.connectivityStrategy == "ScaleFree") {
         int initialNodes = 5;
         int connectionsPerNewNode = 3;
-        auto scaleFreeStrategy = std::make_unique<ScaleFreeConnectivityStrategy>(
-            initialNodes,
-            connectionsPerNewNode
-        );
+        auto scaleFreeStrategy = seeded
+            ? std::make_unique<ScaleFreeConnectivityStrategy>(initialNodes, connectionsPerNewNode, excSeed)
+            : std::make_unique<ScaleFreeConnectivityStrategy>(initialNodes, connectionsPerNewNode);
         setConnectivityStrategy(std::move(scaleFreeStrategy));
         applyConnectivityStrategy();
 
-        auto scaleFreeStrategyInh = std::make_unique<ScaleFreeConnectivityStrategy>(
-            initialNodes,
-            connectionsPerNewNode
-        );
+        auto scaleFreeStrategyInh = seeded
+            ? std::make_unique<ScaleFreeConnectivityStrategy>(initialNodes, connectionsPerNewNode, inhSeed)
+            : std::make_unique<ScaleFreeConnectivityStrategy>(initialNodes, connectionsPerNewNode);
         setConnectivityStrategy(std::move(scaleFreeStrategyInh));
         applyConnectivityStrategy();
     }
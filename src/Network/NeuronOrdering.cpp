@@ -0,0 +1,75 @@
+// src/Network/NeuronOrdering.cpp
+#include "Network/NeuronOrdering.h"
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+    std::vector<std::size_t> reverseCuthillMcKee(const std::vector<std::vector<std::size_t>>& adjacency) {
+        const std::size_t n = adjacency.size();
+        std::vector<std::size_t> order;
+        order.reserve(n);
+        std::vector<bool> visited(n, false);
+
+        // Nodos candidatos a raíz ordenados por grado creciente (uno por componente conexa)
+        std::vector<std::size_t> byDegree(n);
+        std::iota(byDegree.begin(), byDegree.end(), 0);
+        std::stable_sort(byDegree.begin(), byDegree.end(), [&](std::size_t a, std::size_t b) {
+            return adjacency[a].size() < adjacency[b].size();
+        });
+
+        std::vector<std::size_t> neighbours;
+        for (std::size_t root : byDegree) {
+            if (visited[root]) continue;
+
+            std::size_t head = order.size();
+            order.push_back(root);
+            visited[root] = true;
+
+            while (head < order.size()) {
+                std::size_t node = order[head++];
+                neighbours.clear();
+                for (std::size_t v : adjacency[node]) {
+                    if (!visited[v]) {
+                        visited[v] = true;
+                        neighbours.push_back(v);
+                    }
+                }
+                std::stable_sort(neighbours.begin(), neighbours.end(), [&](std::size_t a, std::size_t b) {
+                    return adjacency[a].size() < adjacency[b].size();
+                });
+                order.insert(order.end(), neighbours.begin(), neighbours.end());
+            }
+        }
+
+        std::reverse(order.begin(), order.end());
+        return order;
+    }
+
+    std::vector<std::size_t> degreeDescending(const std::vector<std::vector<std::size_t>>& adjacency) {
+        std::vector<std::size_t> order(adjacency.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+            return adjacency[a].size() > adjacency[b].size();
+        });
+        return order;
+    }
+
+}
+
+std::vector<std::size_t> computeNeuronOrdering(const std::vector<std::vector<std::size_t>>& adjacency,
+                                               NeuronOrdering method)
+{
+    switch (method) {
+        case NeuronOrdering::ReverseCuthillMcKee:
+            return reverseCuthillMcKee(adjacency);
+        case NeuronOrdering::DegreeDescending:
+            return degreeDescending(adjacency);
+    }
+    throw std::invalid_argument("Método de ordenación de neuronas desconocido.");
+}
+
+}
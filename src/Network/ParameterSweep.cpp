@@ -0,0 +1,189 @@
+// src/Network/ParameterSweep.cpp
+#include "Network/ParameterSweep.h"
+#include "Core/Logger.h"
+#include "Neurons/IzhikevichNeuron.h"
+#include "Parallel/SimulationThreadPool.h"
+#include "Synapses/ExcitatorySynapse.h"
+#include "Synapses/InhibitorySynapse.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+    void applyParameter(NetworkManager& manager, SweepParameter parameter, double value) {
+        switch (parameter) {
+            case SweepParameter::BackgroundCurrent:
+                manager.setBackgroundCurrent(value);
+                return;
+            case SweepParameter::StdpAPlus:
+            case SweepParameter::StdpAMinus:
+                for (const auto& neuron : manager.getNeurons()) {
+                    for (const auto& synapse : neuron->getOutgoingSynapses()) {
+                        const bool plus = parameter == SweepParameter::StdpAPlus;
+                        if (auto excitatory = std::dynamic_pointer_cast<ExcitatorySynapse>(synapse)) {
+                            plus ? excitatory->setPotentiationAmplitude(value) : excitatory->setDepressionAmplitude(value);
+                        } else if (auto inhibitory = std::dynamic_pointer_cast<InhibitorySynapse>(synapse)) {
+                            plus ? inhibitory->setPotentiationAmplitude(value) : inhibitory->setDepressionAmplitude(value);
+                        }
+                    }
+                }
+                return;
+            case SweepParameter::IzhikevichA:
+            case SweepParameter::IzhikevichD:
+                for (const auto& neuron : manager.getNeurons()) {
+                    if (auto izhikevich = std::dynamic_pointer_cast<IzhikevichNeuron>(neuron)) {
+                        IzhikevichParameters parameters = izhikevich->getParameters();
+                        (parameter == SweepParameter::IzhikevichA ? parameters.a : parameters.d) = value;
+                        izhikevich->setParameters(parameters);
+                    }
+                }
+                return;
+        }
+        throw std::invalid_argument("Parámetro de barrido desconocido.");
+    }
+
+}
+
+const char* toString(SweepParameter parameter) {
+    switch (parameter) {
+        case SweepParameter::BackgroundCurrent: return "background_current";
+        case SweepParameter::StdpAPlus:         return "stdp_a_plus";
+        case SweepParameter::StdpAMinus:        return "stdp_a_minus";
+        case SweepParameter::IzhikevichA:       return "izhikevich_a";
+        case SweepParameter::IzhikevichD:       return "izhikevich_d";
+    }
+    return "unknown";
+}
+
+ParameterSweep::ParameterSweep(const NetworkConfig& network, std::vector<SweepAxis> sweepAxes,
+                               const SweepConfig& sweepConfig)
+    : axes(std::move(sweepAxes)), config(sweepConfig)
+{
+    if (config.tMax <= 0.0 || config.dt <= 0.0) {
+        throw std::invalid_argument("La duración y el paso del barrido deben ser positivos.");
+    }
+    for (const auto& axis : axes) {
+        if (axis.values.empty()) {
+            throw std::invalid_argument("Cada eje del barrido necesita al menos un valor.");
+        }
+    }
+    topology.createNetwork(network);
+}
+
+std::size_t ParameterSweep::getNumRuns() const {
+    std::size_t runs = 1;
+    for (const auto& axis : axes) {
+        runs *= axis.values.size();
+    }
+    return runs;
+}
+
+std::vector<double> ParameterSweep::getRunValues(std::size_t run) const {
+    if (run >= getNumRuns()) {
+        throw std::out_of_range("Ejecución fuera de rango en getRunValues.");
+    }
+    std::vector<double> values(axes.size());
+    for (std::size_t a = axes.size(); a-- > 0;) {
+        values[a] = axes[a].values[run % axes[a].values.size()];
+        run /= axes[a].values.size();
+    }
+    return values;
+}
+
+SweepRunResult ParameterSweep::runOne(std::size_t run) const {
+    SweepRunResult result;
+    result.values = getRunValues(run);
+
+    // Estado y registro propios de la ejecución
+    auto manager = topology.cloneNetwork();
+    Logger logger;
+    manager->setLogger(&logger);
+    for (std::size_t a = 0; a < axes.size(); ++a) {
+        applyParameter(*manager, axes[a].parameter, result.values[a]);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    manager->setTimeStep(config.dt);
+    manager->advance(manager->getCurrentTick() + static_cast<long long>(config.tMax / config.dt));
+    result.wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    result.spikes = logger.getSpikeCount();
+    result.weightChanges = logger.getWeightChangeCount();
+    result.synapticEvents = manager->getStats().synapticEvents;
+
+    const std::size_t numNeurons = manager->getNeurons().size();
+    if (numNeurons > 0) {
+        result.meanRate = result.spikes / (numNeurons * config.tMax / 1000.0);
+    }
+
+    double weightSum = 0.0;
+    std::size_t excitatoryCount = 0;
+    for (const auto& neuron : manager->getNeurons()) {
+        for (const auto& synapse : neuron->getOutgoingSynapses()) {
+            if (auto excitatory = std::dynamic_pointer_cast<ExcitatorySynapse>(synapse)) {
+                weightSum += excitatory->getWeight();
+                ++excitatoryCount;
+            }
+        }
+    }
+    if (excitatoryCount > 0) {
+        result.meanExcitatoryWeight = weightSum / excitatoryCount;
+    }
+    return result;
+}
+
+const std::vector<SweepRunResult>& ParameterSweep::run() {
+    const std::size_t runs = getNumRuns();
+    results.assign(runs, SweepRunResult{});
+
+    std::size_t numThreads = config.numThreads;
+    if (numThreads == 0) {
+        numThreads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    numThreads = std::min(numThreads, runs);
+
+    // Reparto dinámico: cada hilo toma la siguiente ejecución pendiente
+    std::atomic<std::size_t> next{0};
+    SimulationThreadPool pool(numThreads, config.pinThreads, NumaTopology::detect());
+    pool.runOnAll([&](std::size_t) {
+        for (std::size_t r = next++; r < runs; r = next++) {
+            results[r] = runOne(r);
+        }
+    });
+    return results;
+}
+
+void ParameterSweep::exportCSV(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("No se pudo abrir el archivo para escribir el barrido CSV.");
+    }
+
+    file << "Run";
+    for (const auto& axis : axes) {
+        file << "," << toString(axis.parameter);
+    }
+    file << ",Spikes,MeanRate(Hz),WeightChanges,SynapticEvents,MeanExcitatoryWeight,WallSeconds\n";
+
+    for (std::size_t r = 0; r < results.size(); ++r) {
+        const auto& result = results[r];
+        file << r;
+        for (double value : result.values) {
+            file << "," << value;
+        }
+        file << "," << result.spikes
+             << "," << result.meanRate
+             << "," << result.weightChanges
+             << "," << result.synapticEvents
+             << "," << result.meanExcitatoryWeight
+             << "," << result.wallSeconds << "\n";
+    }
+}
+
+}
@@ -0,0 +1,27 @@
+// src/Network/ProceduralProjection.cpp
+#include "Network/ProceduralProjection.h"
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+ProceduralProjection::ProceduralProjection(const ProceduralProjectionConfig& config)
+    : config(config), logSkip(std::log1p(-config.connectionProbability))
+{
+    if (config.preBegin > config.preEnd || config.postBegin > config.postEnd) {
+        throw std::invalid_argument("Rango de neuronas inválido en la proyección procedural.");
+    }
+    if (config.connectionProbability < 0.0 || config.connectionProbability > 1.0) {
+        throw std::invalid_argument("La probabilidad de conexión debe estar en [0, 1].");
+    }
+    if (config.minWeight > config.maxWeight || config.minDelay > config.maxDelay || config.minDelay < 0.0) {
+        throw std::invalid_argument("Rangos de peso o retardo inválidos en la proyección procedural.");
+    }
+}
+
+double ProceduralProjection::expectedSynapseCount() const {
+    const double pre = static_cast<double>(config.preEnd - config.preBegin);
+    const double post = static_cast<double>(config.postEnd - config.postBegin);
+    return pre * post * config.connectionProbability;
+}
+
+}
@@ -0,0 +1,452 @@
+// src/Network/SimulationServer.cpp
+#include "Network/SimulationServer.h"
+#include "Core/AsyncWriter.h"
+#include "Core/Logger.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+    constexpr int kPollMs = 100;   // Cada cuánto comprueban los hilos si deben parar
+
+    sockaddr_un makeAddress(const std::string& path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.empty() || path.size() >= sizeof(addr.sun_path)) {
+            throw std::invalid_argument("Ruta de socket vacía o demasiado larga: " + path);
+        }
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        return addr;
+    }
+
+    void sendAll(int fd, const std::string& data) {
+        const char* ptr = data.data();
+        std::size_t size = data.size();
+        while (size > 0) {
+            ssize_t n = ::send(fd, ptr, size, MSG_NOSIGNAL);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Error escribiendo en el socket: ") + std::strerror(errno));
+            }
+            ptr += n;
+            size -= static_cast<std::size_t>(n);
+        }
+    }
+
+    double parseDouble(const std::string& key, const std::string& value) {
+        try {
+            std::size_t used = 0;
+            const double parsed = std::stod(value, &used);
+            if (used == value.size()) {
+                return parsed;
+            }
+        } catch (const std::exception&) {
+        }
+        throw std::invalid_argument("Valor numérico no válido para " + key + ": " + value);
+    }
+
+    long long parseInteger(const std::string& key, const std::string& value) {
+        try {
+            std::size_t used = 0;
+            const long long parsed = std::stoll(value, &used);
+            if (used == value.size()) {
+                return parsed;
+            }
+        } catch (const std::exception&) {
+        }
+        throw std::invalid_argument("Valor entero no válido para " + key + ": " + value);
+    }
+
+    std::vector<StimulusPulse> parseStimulus(const std::string& value) {
+        std::vector<StimulusPulse> pulses;
+        std::istringstream list(value);
+        for (std::string item; std::getline(list, item, ',');) {
+            const std::size_t first = item.find(':');
+            const std::size_t second = item.find(':', first == std::string::npos ? first : first + 1);
+            if (first == std::string::npos || second == std::string::npos) {
+                throw std::invalid_argument("Estímulo no válido (se espera neurona:ms:corriente): " + item);
+            }
+            const long long neuron = parseInteger("stimulus", item.substr(0, first));
+            if (neuron < 0) {
+                throw std::invalid_argument("Neurona negativa en el estímulo: " + item);
+            }
+            pulses.push_back(StimulusPulse{static_cast<std::size_t>(neuron),
+                                           parseDouble("stimulus", item.substr(first + 1, second - first - 1)),
+                                           parseDouble("stimulus", item.substr(second + 1))});
+        }
+        return pulses;
+    }
+
+}
+
+NetworkCache::NetworkCache(std::size_t capacity) : capacity(capacity) {}
+
+std::string NetworkCache::makeKey(const NetworkConfig& config) {
+    std::ostringstream key;
+    key << std::setprecision(17)
+        << config.totalNeurons << '|' << config.excitatoryRatio << '|' << config.inhibitoryRatio << '|'
+        << config.excitatoryConnectivity.connectionProbability << '|'
+        << config.excitatoryConnectivity.defaultWeight << '|' << config.excitatoryConnectivity.excitatory << '|'
+        << config.inhibitoryConnectivity.connectionProbability << '|'
+        << config.inhibitoryConnectivity.defaultWeight << '|' << config.inhibitoryConnectivity.excitatory << '|'
+        << config.connectivityStrategy << '|' << config.seed;
+    return key.str();
+}
+
+std::unique_ptr<NetworkManager> NetworkCache::acquire(const NetworkConfig& config, bool* hit) {
+    auto build = [&config]() {
+        auto network = std::make_unique<NetworkManager>();
+        network->setLogger(nullptr);
+        network->createNetwork(config);
+        return network;
+    };
+
+    if (hit) {
+        *hit = false;
+    }
+    if (config.seed < 0 || capacity == 0) {
+        ++misses;
+        return build();
+    }
+
+    const std::string key = makeKey(config);
+    std::shared_ptr<const NetworkManager> network;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto found = lookup.find(key);
+        if (found != lookup.end()) {
+            entries.splice(entries.begin(), entries, found->second);
+            network = found->second->network;
+        }
+    }
+
+    if (network) {
+        ++hits;
+        if (hit) {
+            *hit = true;
+        }
+    } else {
+        // Se construye fuera del mutex; si otro trabajo se adelantó, se usa la suya
+        ++misses;
+        std::shared_ptr<const NetworkManager> built = build();
+        std::lock_guard<std::mutex> lock(mtx);
+        auto found = lookup.find(key);
+        if (found != lookup.end()) {
+            network = found->second->network;
+        } else {
+            entries.push_front(Entry{key, built});
+            lookup[key] = entries.begin();
+            network = std::move(built);
+            while (entries.size() > capacity) {
+                lookup.erase(entries.back().key);
+                entries.pop_back();
+            }
+        }
+    }
+
+    // La plantilla sigue viva mientras se copia aunque otro hilo la desaloje
+    return network->cloneNetwork();
+}
+
+std::shared_ptr<const NetworkManager> NetworkCache::find(const NetworkConfig& config) const {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto found = lookup.find(makeKey(config));
+    return found == lookup.end() ? nullptr : found->second->network;
+}
+
+std::size_t NetworkCache::size() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+SimulationServer::SimulationServer(const ServerConfig& config)
+    : config(config), cache(config.cacheCapacity)
+{
+    if (config.numWorkers == 0) {
+        throw std::invalid_argument("El servidor necesita al menos un hilo de trabajo.");
+    }
+}
+
+SimulationServer::~SimulationServer() {
+    stop();
+}
+
+void SimulationServer::start() {
+    if (acceptor.joinable()) {
+        throw std::logic_error("El servidor ya está en marcha.");
+    }
+    sockaddr_un addr = makeAddress(config.socketPath);
+    ::unlink(config.socketPath.c_str());
+    listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listener < 0 ||
+        ::bind(listener, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(listener, 64) != 0) {
+        const std::string reason = std::strerror(errno);
+        if (listener >= 0) ::close(listener);
+        listener = -1;
+        throw std::runtime_error("No se pudo escuchar en " + config.socketPath + ": " + reason);
+    }
+
+    stopping = false;
+    acceptor = std::thread([this] { acceptLoop(); });
+    for (std::size_t w = 0; w < config.numWorkers; ++w) {
+        workers.emplace_back([this] { workerLoop(); });
+    }
+}
+
+void SimulationServer::requestStop() {
+    std::lock_guard<std::mutex> lock(mtx);
+    stopping = true;
+    queueCv.notify_all();
+    stopCv.notify_all();
+}
+
+void SimulationServer::wait() {
+    if (!acceptor.joinable()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stopCv.wait(lock, [this] { return stopping.load(); });
+    }
+    acceptor.join();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    for (int fd : pendingClients) {
+        ::close(fd);
+    }
+    pendingClients.clear();
+}
+
+void SimulationServer::acceptLoop() {
+    while (!stopping) {
+        pollfd pfd{listener, POLLIN, 0};
+        if (::poll(&pfd, 1, kPollMs) <= 0) {
+            continue;
+        }
+        const int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            continue;
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        pendingClients.push_back(fd);
+        queueCv.notify_one();
+    }
+    ::close(listener);
+    listener = -1;
+    ::unlink(config.socketPath.c_str());
+}
+
+void SimulationServer::workerLoop() {
+    while (true) {
+        int fd = -1;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            queueCv.wait(lock, [this] { return stopping || !pendingClients.empty(); });
+            if (stopping) {
+                return;
+            }
+            fd = pendingClients.front();
+            pendingClients.pop_front();
+        }
+        try {
+            serveClient(fd);
+        } catch (const std::exception&) {
+            // El cliente se desconectó a mitad de una respuesta: solo se cierra su conexión
+        }
+        ::close(fd);
+    }
+}
+
+void SimulationServer::serveClient(int fd) {
+    std::string buffer;
+    char chunk[4096];
+    auto lastActivity = std::chrono::steady_clock::now();
+    while (!stopping) {
+        pollfd pfd{fd, POLLIN, 0};
+        const int ready = ::poll(&pfd, 1, kPollMs);
+        if (ready < 0 && errno != EINTR) {
+            return;
+        }
+        if (ready <= 0) {
+            // Un cliente inactivo no puede retener el hilo indefinidamente
+            if (config.idleTimeoutMs > 0 &&
+                std::chrono::steady_clock::now() - lastActivity >= std::chrono::milliseconds(config.idleTimeoutMs)) {
+                return;
+            }
+            continue;
+        }
+        const ssize_t n = ::read(fd, chunk, sizeof(chunk));
+        if (n <= 0) {
+            if (n < 0 && errno == EINTR) continue;
+            return;
+        }
+        buffer.append(chunk, static_cast<std::size_t>(n));
+        for (std::size_t end = buffer.find('\n'); end != std::string::npos; end = buffer.find('\n')) {
+            const std::string line = buffer.substr(0, end);
+            buffer.erase(0, end + 1);
+            sendAll(fd, handleRequest(line) + "\n");
+        }
+        lastActivity = std::chrono::steady_clock::now();
+    }
+}
+
+SimulationJob SimulationServer::parseJob(const std::string& line) {
+    SimulationJob job;
+    NetworkConfig &network = job.network;
+    network.totalNeurons = 1000;
+    network.excitatoryRatio = 0.8;
+    network.inhibitoryRatio = 0.2;
+    network.connectivityStrategy = "Random";
+    network.excitatoryConnectivity = ConnectivityParameters{0.02, 0.5, true};
+    network.inhibitoryConnectivity = ConnectivityParameters{0.02, 0.5, false};
+
+    std::istringstream fields(line);
+    for (std::string field; fields >> field;) {
+        const std::size_t eq = field.find('=');
+        if (eq == std::string::npos) {
+            throw std::invalid_argument("Campo sin valor: " + field);
+        }
+        const std::string key = field.substr(0, eq);
+        const std::string value = field.substr(eq + 1);
+        if (key == "neurons") network.totalNeurons = static_cast<int>(parseInteger(key, value));
+        else if (key == "excitatory_ratio") network.excitatoryRatio = parseDouble(key, value);
+        else if (key == "inhibitory_ratio") network.inhibitoryRatio = parseDouble(key, value);
+        else if (key == "strategy") network.connectivityStrategy = value;
+        else if (key == "exc_probability") network.excitatoryConnectivity.connectionProbability = parseDouble(key, value);
+        else if (key == "exc_weight") network.excitatoryConnectivity.defaultWeight = parseDouble(key, value);
+        else if (key == "inh_probability") network.inhibitoryConnectivity.connectionProbability = parseDouble(key, value);
+        else if (key == "inh_weight") network.inhibitoryConnectivity.defaultWeight = parseDouble(key, value);
+        else if (key == "seed") network.seed = parseInteger(key, value);
+        else if (key == "duration") job.duration = parseDouble(key, value);
+        else if (key == "dt") job.dt = parseDouble(key, value);
+        else if (key == "background") job.backgroundCurrent = parseDouble(key, value);
+        else if (key == "stimulus") job.stimulus = parseStimulus(value);
+        else if (key == "output") job.output = value;
+        else throw std::invalid_argument("Campo desconocido: " + key);
+    }
+    return job;
+}
+
+JobResult SimulationServer::runJob(const SimulationJob& job) {
+    if (job.network.totalNeurons <= 0 || job.duration <= 0.0 || job.dt <= 0.0) {
+        throw std::invalid_argument("El número de neuronas, la duración y el paso deben ser positivos.");
+    }
+    if (job.output.find('/') != std::string::npos || job.output == "." || job.output == "..") {
+        throw std::invalid_argument("El nombre de salida no puede contener rutas: " + job.output);
+    }
+
+    JobResult result;
+    const auto buildStart = std::chrono::steady_clock::now();
+    auto manager = cache.acquire(job.network, &result.cacheHit);
+    const auto runStart = std::chrono::steady_clock::now();
+    result.buildSeconds = std::chrono::duration<double>(runStart - buildStart).count();
+
+    Logger logger;
+    if (!job.output.empty()) {
+        AsyncWriterConfig writerConfig;
+        writerConfig.spikesFile = config.outputDirectory + "/" + job.output + "_spikes.csv";
+        writerConfig.weightChangesFile = config.outputDirectory + "/" + job.output + "_weight_changes.csv";
+        logger.startStreaming(writerConfig);
+    }
+    manager->setLogger(&logger);
+    manager->setTimeStep(job.dt);
+    manager->setBackgroundCurrent(job.backgroundCurrent);
+
+    std::vector<StimulusPulse> stimulus = job.stimulus;
+    std::stable_sort(stimulus.begin(), stimulus.end(),
+                     [](const StimulusPulse& a, const StimulusPulse& b) { return a.time < b.time; });
+    const long long steps = static_cast<long long>(job.duration / job.dt);
+    for (const auto &pulse : stimulus) {
+        const long long tick = std::max(0LL, static_cast<long long>(std::llround(pulse.time / job.dt)));
+        if (tick >= steps) {
+            break;
+        }
+        manager->advance(tick);
+        manager->injectExternalCurrent(pulse.neuron, pulse.current);
+    }
+    manager->advance(steps);
+    logger.stopStreaming();
+
+    result.runSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+    result.spikes = logger.getSpikeCount();
+    result.weightChanges = logger.getWeightChangeCount();
+    result.synapticEvents = manager->getStats().synapticEvents;
+    ++completedJobs;
+    return result;
+}
+
+std::string SimulationServer::handleRequest(const std::string& line) {
+    std::string request = line;
+    request.erase(std::remove(request.begin(), request.end(), '\r'), request.end());
+    if (request == "shutdown") {
+        requestStop();
+        return "ok";
+    }
+    try {
+        const JobResult result = runJob(parseJob(request));
+        std::ostringstream response;
+        response << "ok cached=" << (result.cacheHit ? 1 : 0)
+                 << " spikes=" << result.spikes
+                 << " weight_changes=" << result.weightChanges
+                 << " synaptic_events=" << result.synapticEvents
+                 << " build_ms=" << result.buildSeconds * 1000.0
+                 << " run_ms=" << result.runSeconds * 1000.0;
+        return response.str();
+    } catch (const std::exception& e) {
+        return std::string("error ") + e.what();
+    }
+}
+
+std::string SimulationServer::sendRequest(const std::string& socketPath, const std::string& request,
+                                          int timeoutMs)
+{
+    sockaddr_un addr = makeAddress(socketPath);
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0 || ::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+        const std::string reason = std::strerror(errno);
+        if (fd >= 0) ::close(fd);
+        throw std::runtime_error("No se pudo conectar con " + socketPath + ": " + reason);
+    }
+
+    std::string response;
+    try {
+        sendAll(fd, request + "\n");
+        char chunk[4096];
+        while (response.find('\n') == std::string::npos) {
+            pollfd pfd{fd, POLLIN, 0};
+            const int ready = ::poll(&pfd, 1, timeoutMs);
+            if (ready == 0) {
+                throw std::runtime_error("Tiempo agotado esperando la respuesta del servidor.");
+            }
+            const ssize_t n = ready > 0 ? ::read(fd, chunk, sizeof(chunk)) : -1;
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n <= 0) {
+                throw std::runtime_error("Conexión cerrada por el servidor.");
+            }
+            response.append(chunk, static_cast<std::size_t>(n));
+        }
+    } catch (...) {
+        ::close(fd);
+        throw;
+    }
+    ::close(fd);
+    return response.substr(0, response.find('\n'));
+}
+
+}
@@ -0,0 +1,323 @@
+// src/Network/UnixSocketTransport.cpp
+#include "Network/UnixSocketTransport.h"
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+    void setNonBlocking(int fd) {
+        int flags = fcntl(fd, F_GETFL, 0);
+        if (flags < 0 || fcntl(fd, F_SETFL, flags | O_NONBLOCK) < 0) {
+            throw std::runtime_error("No se pudo configurar el socket como no bloqueante.");
+        }
+    }
+
+    void writeAll(int fd, const void* data, std::size_t size) {
+        const char* ptr = static_cast<const char*>(data);
+        while (size > 0) {
+            ssize_t n = ::write(fd, ptr, size);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Error escribiendo en el socket: ") + std::strerror(errno));
+            }
+            ptr += n;
+            size -= static_cast<std::size_t>(n);
+        }
+    }
+
+    void readAll(int fd, void* data, std::size_t size) {
+        char* ptr = static_cast<char*>(data);
+        while (size > 0) {
+            ssize_t n = ::read(fd, ptr, size);
+            if (n == 0) {
+                throw std::runtime_error("Conexión cerrada por el rank remoto.");
+            }
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                throw std::runtime_error(std::string("Error leyendo del socket: ") + std::strerror(errno));
+            }
+            ptr += n;
+            size -= static_cast<std::size_t>(n);
+        }
+    }
+
+    sockaddr_un makeAddress(const std::string& path) {
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) {
+            throw std::invalid_argument("Ruta de socket demasiado larga: " + path);
+        }
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+        return addr;
+    }
+
+    std::string socketPath(const std::string& directory, int rank) {
+        return directory + "/rank_" + std::to_string(rank) + ".sock";
+    }
+
+}
+
+UnixSocketTransport::UnixSocketTransport(int rank, std::vector<int> peerFds)
+    : rank(rank), peers(std::move(peerFds))
+{
+    for (int fd : peers) {
+        if (fd >= 0) {
+            setNonBlocking(fd);
+        }
+    }
+}
+
+UnixSocketTransport::~UnixSocketTransport() {
+    for (int fd : peers) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+    }
+}
+
+std::vector<std::unique_ptr<UnixSocketTransport>> UnixSocketTransport::createLocalGroup(int size) {
+    if (size < 1) {
+        throw std::invalid_argument("El grupo debe tener al menos un rank.");
+    }
+
+    std::vector<std::vector<int>> fds(size, std::vector<int>(size, -1));
+    for (int i = 0; i < size; ++i) {
+        for (int j = i + 1; j < size; ++j) {
+            int pair[2];
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, pair) != 0) {
+                throw std::runtime_error(std::string("socketpair falló: ") + std::strerror(errno));
+            }
+            fds[i][j] = pair[0];
+            fds[j][i] = pair[1];
+        }
+    }
+
+    std::vector<std::unique_ptr<UnixSocketTransport>> group;
+    for (int r = 0; r < size; ++r) {
+        group.emplace_back(new UnixSocketTransport(r, fds[r]));
+    }
+    return group;
+}
+
+std::unique_ptr<UnixSocketTransport> UnixSocketTransport::connect(const std::string& socketDirectory,
+                                                                  int rank, int size, int timeoutMs)
+{
+    if (rank < 0 || rank >= size) {
+        throw std::invalid_argument("Rank fuera de rango en UnixSocketTransport::connect.");
+    }
+
+    std::vector<int> fds(size, -1);
+
+    const std::string ownPath = socketPath(socketDirectory, rank);
+    ::unlink(ownPath.c_str());
+    int listener = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    sockaddr_un ownAddr = makeAddress(ownPath);
+    if (listener < 0 ||
+        ::bind(listener, reinterpret_cast<sockaddr*>(&ownAddr), sizeof(ownAddr)) != 0 ||
+        ::listen(listener, size) != 0) {
+        if (listener >= 0) ::close(listener);
+        throw std::runtime_error("No se pudo escuchar en " + ownPath + ": " + std::strerror(errno));
+    }
+
+    // Conectar con los ranks inferiores, reintentando hasta que estén escuchando
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    for (int peer = 0; peer < rank; ++peer) {
+        sockaddr_un addr = makeAddress(socketPath(socketDirectory, peer));
+        while (true) {
+            int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+                std::int32_t me = rank;
+                writeAll(fd, &me, sizeof(me));
+                fds[peer] = fd;
+                break;
+            }
+            ::close(fd);
+            if (std::chrono::steady_clock::now() > deadline) {
+                ::close(listener);
+                throw std::runtime_error("Tiempo agotado conectando con el rank " + std::to_string(peer) + ".");
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    // Aceptar a los ranks superiores
+    for (int pending = size - 1 - rank; pending > 0; --pending) {
+        int fd = ::accept(listener, nullptr, nullptr);
+        if (fd < 0) {
+            ::close(listener);
+            throw std::runtime_error(std::string("accept falló: ") + std::strerror(errno));
+        }
+        std::int32_t peer = -1;
+        readAll(fd, &peer, sizeof(peer));
+        if (peer <= rank || peer >= size || fds[peer] >= 0) {
+            ::close(fd);
+            ::close(listener);
+            throw std::runtime_error("Rank remoto inválido durante la conexión.");
+        }
+        fds[peer] = fd;
+    }
+
+    ::close(listener);
+    ::unlink(ownPath.c_str());
+    return std::unique_ptr<UnixSocketTransport>(new UnixSocketTransport(rank, std::move(fds)));
+}
+
+void UnixSocketTransport::allToAll(const std::vector<char>& payload,
+                                   std::vector<std::vector<char>>& received)
+{
+    struct PeerState {
+        std::size_t sent = 0;           // Bytes enviados (cabecera + datos)
+        std::uint64_t header = 0;       // Longitud anunciada por el par
+        std::size_t headerRead = 0;
+        std::size_t bodyRead = 0;
+        bool done = false;
+    };
+
+    const int size = getSize();
+    const std::uint64_t length = payload.size();
+    const std::size_t totalOut = sizeof(length) + payload.size();
+
+    std::vector<PeerState> state(size);
+    received.assign(size, {});
+    int pendingOps = 0;
+    for (int p = 0; p < size; ++p) {
+        if (p != rank) pendingOps += 2;
+    }
+
+    // Avance no bloqueante de todos los envíos y recepciones para evitar bloqueos mutuos
+    std::vector<pollfd> pfds;
+    std::vector<int> owners;
+    while (pendingOps > 0) {
+        pfds.clear();
+        owners.clear();
+        for (int p = 0; p < size; ++p) {
+            if (p == rank) continue;
+            short events = 0;
+            if (state[p].sent < totalOut) events |= POLLOUT;
+            if (!state[p].done) events |= POLLIN;
+            if (events) {
+                pfds.push_back(pollfd{peers[p], events, 0});
+                owners.push_back(p);
+            }
+        }
+
+        if (::poll(pfds.data(), pfds.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            throw std::runtime_error(std::string("poll falló: ") + std::strerror(errno));
+        }
+
+        for (std::size_t i = 0; i < pfds.size(); ++i) {
+            const int p = owners[i];
+            PeerState& st = state[p];
+            const int fd = pfds[i].fd;
+
+            if ((pfds[i].revents & POLLOUT) && st.sent < totalOut) {
+                while (st.sent < totalOut) {
+                    const char* src;
+                    std::size_t avail;
+                    if (st.sent < sizeof(length)) {
+                        src = reinterpret_cast<const char*>(&length) + st.sent;
+                        avail = sizeof(length) - st.sent;
+                    } else {
+                        src = payload.data() + (st.sent - sizeof(length));
+                        avail = totalOut - st.sent;
+                    }
+                    ssize_t n = ::send(fd, src, avail, MSG_NOSIGNAL);
+                    if (n < 0) {
+                        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) break;
+                        throw std::runtime_error(std::string("Error enviando spikes: ") + std::strerror(errno));
+                    }
+                    st.sent += static_cast<std::size_t>(n);
+                }
+                if (st.sent == totalOut) --pendingOps;
+            }
+
+            if ((pfds[i].revents & (POLLIN | POLLHUP | POLLERR)) && !st.done) {
+                while (!st.done) {
+                    char* dst;
+                    std::size_t want;
+                    if (st.headerRead < sizeof(st.header)) {
+                        dst = reinterpret_cast<char*>(&st.header) + st.headerRead;
+                        want = sizeof(st.header) - st.headerRead;
+                    } else {
+                        dst = received[p].data() + st.bodyRead;
+                        want = received[p].size() - st.bodyRead;
+                    }
+                    ssize_t n = want > 0 ? ::recv(fd, dst, want, 0) : 0;
+                    if (want > 0 && n == 0) {
+                        throw std::runtime_error("Conexión cerrada por el rank " + std::to_string(p) + ".");
+                    }
+                    if (n < 0) {
+                        if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) break;
+                        throw std::runtime_error(std::string("Error recibiendo spikes: ") + std::strerror(errno));
+                    }
+                    if (st.headerRead < sizeof(st.header)) {
+                        st.headerRead += static_cast<std::size_t>(n);
+                        if (st.headerRead == sizeof(st.header)) {
+                            received[p].resize(st.header);
+                        }
+                    } else {
+                        st.bodyRead += static_cast<std::size_t>(n);
+                    }
+                    if (st.headerRead == sizeof(st.header) && st.bodyRead == received[p].size()) {
+                        st.done = true;
+                        --pendingOps;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void UnixSocketTransport::exchange(const std::vector<RemoteSpike>& outgoing,
+                                   std::vector<RemoteSpike>& incoming)
+{
+    std::vector<char> payload(outgoing.size() * sizeof(RemoteSpike));
+    if (!payload.empty()) {
+        std::memcpy(payload.data(), outgoing.data(), payload.size());
+    }
+
+    std::vector<std::vector<char>> received;
+    allToAll(payload, received);
+
+    incoming.clear();
+    for (const auto& block : received) {
+        const std::size_t count = block.size() / sizeof(RemoteSpike);
+        const std::size_t offset = incoming.size();
+        incoming.resize(offset + count);
+        if (count > 0) {
+            std::memcpy(incoming.data() + offset, block.data(), count * sizeof(RemoteSpike));
+        }
+    }
+}
+
+double UnixSocketTransport::minAcrossRanks(double value) {
+    std::vector<char> payload(sizeof(double));
+    std::memcpy(payload.data(), &value, sizeof(double));
+
+    std::vector<std::vector<char>> received;
+    allToAll(payload, received);
+
+    double result = value;
+    for (const auto& block : received) {
+        if (block.size() == sizeof(double)) {
+            double other;
+            std::memcpy(&other, block.data(), sizeof(double));
+            result = std::min(result, other);
+        }
+    }
+    return result;
+}
+
+}
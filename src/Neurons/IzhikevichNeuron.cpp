@@ -1,13 +1,14 @@
 // src/Neurons/IzhikevichNeuron.cpp
 #include "Neurons/IzhikevichNeuron.h"
-#include "Core/Logger.h" // Incluir el Logger
+#include "Parallel/PlacementArena.h"
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
 #include <cmath>
 
 namespace BioNeuralNetwork {
 
-int IzhikevichNeuron::id_counter = 0;
+std::atomic<int> IzhikevichNeuron::id_counter{0};
 
 IzhikevichNeuron::IzhikevichNeuron(double a_param,
                                    double b_param,
@@ -40,8 +41,7 @@ IzhikevichNeuron::IzhikevichNeuron(double a_param,
 double IzhikevichNeuron::stepSimulation(double dt, double currentTime)
 {
     // Subdividir dt para mayor precisión
-    const double subdt = 0.1;
-    int nSteps = static_cast<int>(std::ceil(dt / subdt));
+    int nSteps = substep > 0.0 ? std::max(1, static_cast<int>(std::ceil(dt / substep))) : 1;
     double actualSubdt = dt / nSteps;
 
     fired = false;
@@ -53,7 +53,7 @@ double IzhikevichNeuron::stepSimulation(double dt, double currentTime)
             continue;
         }
 
-        double dV = (0.04 * V * V + 5.0 * V + 140.0 - u + R * accumulatedCurrent) * actualSubdt;
+        double dV = (0.04 * V * V + 5.0 * V + 140.0 - u + R * (accumulatedCurrent + synaptic.current(V))) * actualSubdt;
         V += dV;
 
         double du = a * (b * V - u) * actualSubdt;
@@ -66,12 +66,11 @@ double IzhikevichNeuron::stepSimulation(double dt, double currentTime)
 
             timeSinceLastSpike = 0.0;
             lastSpikeTime = currentTime + (i + 1) * actualSubdt;
-
-            // Registrar el spike
-            Logger::getInstance().logSpike(id, lastSpikeTime);
         }
     }
 
+    // Estado sináptico constante durante el paso; la conductancia usa el V de cada subpaso
+    synaptic.decay(dt);
     resetAccumulatedCurrent();
     return V;
 }
@@ -100,6 +99,14 @@ void IzhikevichNeuron::resetAccumulatedCurrent() {
     accumulatedCurrent = 0.0;
 }
 
+void IzhikevichNeuron::receiveSynapticInput(double weight, Receptor receptor) {
+    if (synaptic.isInstantaneous()) {
+        accumulatedCurrent += receptor == Receptor::Excitatory ? weight : -weight;
+    } else {
+        synaptic.receive(weight, receptor);
+    }
+}
+
 void IzhikevichNeuron::addIncomingSynapse(std::shared_ptr<ISynapse> synapse) {
     incomingSynapses.push_back(synapse);
 }
@@ -108,6 +115,19 @@ void IzhikevichNeuron::addOutgoingSynapse(std::shared_ptr<ISynapse> synapse) {
     outgoingSynapses.push_back(synapse);
 }
 
+void IzhikevichNeuron::removeSynapsesIf(const std::function<bool(const ISynapse&)>& pruned) {
+    auto matches = [&](const std::shared_ptr<ISynapse>& synapse) { return pruned(*synapse); };
+    outgoingSynapses.erase(std::remove_if(outgoingSynapses.begin(), outgoingSynapses.end(), matches),
+                           outgoingSynapses.end());
+    incomingSynapses.erase(std::remove_if(incomingSynapses.begin(), incomingSynapses.end(), matches),
+                           incomingSynapses.end());
+}
+
+void IzhikevichNeuron::reserveSynapses(std::size_t additionalOutgoing, std::size_t additionalIncoming) {
+    outgoingSynapses.reserve(outgoingSynapses.size() + additionalOutgoing);
+    incomingSynapses.reserve(incomingSynapses.size() + additionalIncoming);
+}
+
 int IzhikevichNeuron::getID() const {
     return id;
 }
@@ -132,4 +152,67 @@ double IzhikevichNeuron::getResetPotential() const {
     return V_reset;
 }
 
+long long IzhikevichNeuron::quiescentHorizon(long long maxSteps, double, double current, double tolerance) const {
+    // Sin forma cerrada: solo se salta en el reposo estable, es decir, con derivadas
+    // despreciables y V a la izquierda del vértice de la nulclina 0.04V² + (5 - b)V + ...
+    // Por encima de la reobase la nulclina no tiene raíces: no hay reposo y la neurona
+    // dispara de forma tónica (con los parámetros por defecto, R·current > 4; la
+    // corriente de fondo por defecto, 10, está por encima), así que nunca se salta
+    const double discriminant = (5.0 - b) * (5.0 - b) - 0.16 * (140.0 + R * current);
+    if (discriminant < 0.0) {
+        return 0;
+    }
+    const double dV = 0.04 * V * V + 5.0 * V + 140.0 - u + R * current;
+    const double du = a * (b * V - u);
+    const double vertex = -(5.0 - b) / 0.08;
+    if (accumulatedCurrent != 0.0 || !synaptic.isIdle() || std::abs(dV) > tolerance || std::abs(du) > tolerance || V >= vertex || V >= V_threshold) {
+        return 0;
+    }
+    return maxSteps;
+}
+
+void IzhikevichNeuron::skipQuiescent(long long steps, double dt, double) {
+    // En reposo el estado no cambia: basta con avanzar el reloj refractario
+    timeSinceLastSpike += steps * dt;
+    fired = false;
+    resetAccumulatedCurrent();
+}
+
+std::shared_ptr<INeuron> IzhikevichNeuron::clone() const {
+    auto copy = std::make_shared<IzhikevichNeuron>(*this);
+    copy->incomingSynapses.clear();
+    copy->outgoingSynapses.clear();
+    return copy;
+}
+
+std::shared_ptr<INeuron> IzhikevichNeuron::cloneInto(const std::shared_ptr<PlacementArena>& arena) const {
+    auto copy = std::allocate_shared<IzhikevichNeuron>(ArenaAllocator<IzhikevichNeuron>(arena), *this);
+    copy->incomingSynapses.clear();
+    copy->outgoingSynapses.clear();
+    return copy;
+}
+
+IzhikevichParameters IzhikevichNeuron::getParameters() const {
+    return IzhikevichParameters{a, b, c, d, V_threshold, V_reset, R, C, refractoryPeriod};
+}
+
+void IzhikevichNeuron::setParameters(const IzhikevichParameters& parameters) {
+    a = parameters.a;
+    b = parameters.b;
+    c = parameters.c;
+    d = parameters.d;
+    V_threshold = parameters.V_threshold;
+    V_reset = parameters.V_reset;
+    R = parameters.R;
+    C = parameters.C;
+    refractoryPeriod = parameters.refractoryPeriod;
+}
+
+void IzhikevichNeuron::setSubstep(double newSubstep) {
+    if (newSubstep < 0.0) {
+        throw std::invalid_argument("El subpaso de integración no puede ser negativo.");
+    }
+    substep = newSubstep;
+}
+
 }
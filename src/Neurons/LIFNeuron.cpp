@@ -1,12 +1,13 @@
 // src/Neurons/LIFNeuron.cpp
 #include "Neurons/LIFNeuron.h"
-#include "Core/Logger.h" // Incluir el Logger
+#include "Parallel/PlacementArena.h"
+#include <algorithm>
 #include <cmath>
 
 namespace BioNeuralNetwork {
 
 
-int LIFNeuron::id_counter = 0;
+std::atomic<int> LIFNeuron::id_counter{0};
 
 LIFNeuron::LIFNeuron(double vRest,
                      double vReset,
@@ -34,11 +35,15 @@ double LIFNeuron::stepSimulation(double dt, double currentTime)
     timeSinceLastSpike += dt;
     fired = false;
 
+    // La corriente sináptica se evalúa con el V del inicio del paso y luego decae
+    const double synapticCurrent = synaptic.current(V_current);
+    synaptic.decay(dt);
+
     if (timeSinceLastSpike < refractoryPeriod) {
         return V_current;
     }
 
-    double dV = (-(V_current - V_rest) + R * accumulatedCurrent) / (R * C);
+    double dV = (-(V_current - V_rest) + R * (accumulatedCurrent + synapticCurrent)) / (R * C);
     V_current += dV * dt;
 
     if (V_current >= V_threshold) {
@@ -46,8 +51,6 @@ double LIFNeuron::stepSimulation(double dt, double currentTime)
         V_current = V_reset;
         timeSinceLastSpike = 0.0;
         lastSpikeTime = currentTime;
-
-        Logger::getInstance().logSpike(id, lastSpikeTime);
     }
 
     resetAccumulatedCurrent();
@@ -78,6 +81,14 @@ void LIFNeuron::resetAccumulatedCurrent() {
     accumulatedCurrent = 0.0;
 }
 
+void LIFNeuron::receiveSynapticInput(double weight, Receptor receptor) {
+    if (synaptic.isInstantaneous()) {
+        accumulatedCurrent += receptor == Receptor::Excitatory ? weight : -weight;
+    } else {
+        synaptic.receive(weight, receptor);
+    }
+}
+
 void LIFNeuron::addIncomingSynapse(std::shared_ptr<ISynapse> synapse) {
     incomingSynapses.push_back(synapse);
 }
@@ -86,6 +97,19 @@ void LIFNeuron::addOutgoingSynapse(std::shared_ptr<ISynapse> synapse) {
     outgoingSynapses.push_back(synapse);
 }
 
+void LIFNeuron::removeSynapsesIf(const std::function<bool(const ISynapse&)>& pruned) {
+    auto matches = [&](const std::shared_ptr<ISynapse>& synapse) { return pruned(*synapse); };
+    outgoingSynapses.erase(std::remove_if(outgoingSynapses.begin(), outgoingSynapses.end(), matches),
+                           outgoingSynapses.end());
+    incomingSynapses.erase(std::remove_if(incomingSynapses.begin(), incomingSynapses.end(), matches),
+                           incomingSynapses.end());
+}
+
+void LIFNeuron::reserveSynapses(std::size_t additionalOutgoing, std::size_t additionalIncoming) {
+    outgoingSynapses.reserve(outgoingSynapses.size() + additionalOutgoing);
+    incomingSynapses.reserve(incomingSynapses.size() + additionalIncoming);
+}
+
 int LIFNeuron::getID() const {
     return id;
 }
@@ -110,4 +134,47 @@ double LIFNeuron::getResetPotential() const {
     return V_reset;
 }
 
+long long LIFNeuron::quiescentHorizon(long long maxSteps, double dt, double current, double) const {
+    // Con corriente constante V se acerca monótonamente a V_inf si 0 <= 1 - dt/(RC) < 1:
+    // si V y V_inf están bajo el umbral, no hay disparo en ningún paso
+    const double factor = 1.0 - dt / (R * C);
+    const double vInf = V_rest + R * current;
+    if (accumulatedCurrent != 0.0 || !synaptic.isIdle() || factor < 0.0 || factor >= 1.0 ||
+        vInf >= V_threshold || V_current >= V_threshold) {
+        return 0;
+    }
+    return maxSteps;
+}
+
+void LIFNeuron::skipQuiescent(long long steps, double dt, double current) {
+    // Los pasos refractarios no modifican V
+    long long frozen = 0;
+    while (frozen < steps && timeSinceLastSpike + dt < refractoryPeriod) {
+        timeSinceLastSpike += dt;
+        ++frozen;
+    }
+    const long long decaying = steps - frozen;
+    timeSinceLastSpike += decaying * dt;
+
+    // Forma cerrada de la integración de Euler: V_k = V_inf + (V_0 - V_inf) (1 - dt/RC)^k
+    const double vInf = V_rest + R * current;
+    V_current = vInf + (V_current - vInf) * std::pow(1.0 - dt / (R * C), static_cast<double>(decaying));
+    fired = false;
+    resetAccumulatedCurrent();
+}
+
+std::shared_ptr<INeuron> LIFNeuron::clone() const {
+    auto copy = std::make_shared<LIFNeuron>(*this);
+    copy->incomingSynapses.clear();
+    copy->outgoingSynapses.clear();
+    return copy;
+}
+
+std::shared_ptr<INeuron> LIFNeuron::cloneInto(const std::shared_ptr<PlacementArena>& arena) const {
+    auto copy = std::allocate_shared<LIFNeuron>(ArenaAllocator<LIFNeuron>(arena), *this);
+    copy->incomingSynapses.clear();
+    copy->outgoingSynapses.clear();
+    return copy;
+}
+
 }
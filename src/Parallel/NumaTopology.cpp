@@ -0,0 +1,140 @@
+// src/Parallel/NumaTopology.cpp
+#include "Parallel/NumaTopology.h"
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace BioNeuralNetwork {
+
+namespace {
+
+    constexpr std::size_t kHugePageSize = 2u * 1024u * 1024u;
+
+    // Interpreta listas de CPU con el formato de /sys: "0-3,8,10-11"
+    std::vector<int> parseCpuList(const std::string& text) {
+        std::vector<int> result;
+        std::stringstream ss(text);
+        std::string range;
+        while (std::getline(ss, range, ',')) {
+            if (range.empty() || range == "\n") continue;
+            auto dash = range.find('-');
+            try {
+                if (dash == std::string::npos) {
+                    result.push_back(std::stoi(range));
+                } else {
+                    int first = std::stoi(range.substr(0, dash));
+                    int last = std::stoi(range.substr(dash + 1));
+                    for (int cpu = first; cpu <= last; ++cpu) {
+                        result.push_back(cpu);
+                    }
+                }
+            } catch (const std::exception&) {
+                // Entrada malformada: se ignora
+            }
+        }
+        return result;
+    }
+
+}
+
+NumaTopology NumaTopology::detect() {
+    NumaTopology topology;
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &allowed)) {
+                topology.cpus.push_back(cpu);
+            }
+        }
+    }
+    if (topology.cpus.empty()) {
+        topology.cpus.push_back(0);
+    }
+
+    const int maxCpu = *std::max_element(topology.cpus.begin(), topology.cpus.end());
+    topology.cpuToNode.assign(static_cast<std::size_t>(maxCpu) + 1, 0);
+
+    std::size_t nodes = 0;
+    for (int node = 0; node < 1024; ++node) {
+        std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        if (!file.is_open()) {
+            break;
+        }
+        std::string text;
+        std::getline(file, text);
+        for (int cpu : parseCpuList(text)) {
+            if (cpu >= 0 && cpu <= maxCpu) {
+                topology.cpuToNode[cpu] = node;
+            }
+        }
+        nodes = static_cast<std::size_t>(node) + 1;
+    }
+    topology.numNodes = std::max<std::size_t>(1, nodes);
+
+    // Agrupar las CPU por nodo para que hilos consecutivos compartan nodo
+    std::stable_sort(topology.cpus.begin(), topology.cpus.end(), [&](int a, int b) {
+        return topology.cpuToNode[a] < topology.cpuToNode[b];
+    });
+    return topology;
+}
+
+int NumaTopology::getNodeOfCpu(int cpu) const {
+    if (cpu < 0 || static_cast<std::size_t>(cpu) >= cpuToNode.size()) {
+        return -1;
+    }
+    return cpuToNode[cpu];
+}
+
+bool NumaTopology::pinCurrentThread(int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+int NumaTopology::getNodeOfAddress(const void* ptr) {
+#ifdef SYS_move_pages
+    const std::uintptr_t pageSize = static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+    void* page = reinterpret_cast<void*>(reinterpret_cast<std::uintptr_t>(ptr) & ~(pageSize - 1));
+    int status = -1;
+    // Con nodes == nullptr move_pages solo consulta la ubicación actual
+    long rc = syscall(SYS_move_pages, 0, 1UL, &page, nullptr, &status, 0);
+    if (rc == 0 && status >= 0) {
+        return status;
+    }
+#else
+    (void)ptr;
+#endif
+    return -1;
+}
+
+bool NumaTopology::adviseHugePages(void* ptr, std::size_t bytes) {
+#ifdef MADV_HUGEPAGE
+    std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(ptr);
+    std::uintptr_t end = begin + bytes;
+    std::uintptr_t alignedBegin = (begin + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    std::uintptr_t alignedEnd = end & ~(kHugePageSize - 1);
+    if (alignedEnd <= alignedBegin) {
+        return false;
+    }
+    return madvise(reinterpret_cast<void*>(alignedBegin), alignedEnd - alignedBegin, MADV_HUGEPAGE) == 0;
+#else
+    (void)ptr;
+    (void)bytes;
+    return false;
+#endif
+}
+
+}
@@ -0,0 +1,55 @@
+// src/Parallel/PlacementArena.cpp
+#include "Parallel/PlacementArena.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include "Parallel/NumaTopology.h"
+
+namespace BioNeuralNetwork {
+
+namespace {
+    constexpr std::size_t kHugePageSize = 2u * 1024u * 1024u;
+
+    std::size_t roundUp(std::size_t value, std::size_t multiple) {
+        return (value + multiple - 1) / multiple * multiple;
+    }
+}
+
+PlacementArena::PlacementArena(bool hugePages, std::size_t blockBytes)
+    : hugePages(hugePages), blockBytes(roundUp(blockBytes == 0 ? kHugePageSize : blockBytes, kHugePageSize))
+{
+}
+
+PlacementArena::~PlacementArena() {
+    for (void* block : blocks) {
+        std::free(block);
+    }
+}
+
+void* PlacementArena::allocate(std::size_t bytes, std::size_t alignment) {
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(cursor);
+    std::size_t padding = (alignment - address % alignment) % alignment;
+    if (!cursor || padding + bytes > remaining) {
+        // Bloque nuevo: el resto del anterior se pierde
+        const std::size_t size = std::max(blockBytes, roundUp(bytes + alignment, kHugePageSize));
+        void* block = std::aligned_alloc(kHugePageSize, size);
+        if (!block) {
+            throw std::bad_alloc();
+        }
+        blocks.push_back(block);
+        if (hugePages && NumaTopology::adviseHugePages(block, size)) {
+            ++advisedBlocks;
+        }
+        reservedBytes += size;
+        cursor = static_cast<char*>(block);
+        remaining = size;
+        padding = 0;
+    }
+    void* result = cursor + padding;
+    cursor += padding + bytes;
+    remaining -= padding + bytes;
+    return result;
+}
+
+}
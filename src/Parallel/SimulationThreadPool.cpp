@@ -0,0 +1,101 @@
+// src/Parallel/SimulationThreadPool.cpp
+#include "Parallel/SimulationThreadPool.h"
+#include <stdexcept>
+
+namespace BioNeuralNetwork {
+
+SimulationThreadPool::SimulationThreadPool(std::size_t numThreads, bool pinThreads, const NumaTopology& topology)
+    : cpus(numThreads, -1), nodes(numThreads, 0)
+{
+    if (numThreads == 0) {
+        throw std::invalid_argument("El grupo de hilos necesita al menos un hilo.");
+    }
+
+    const auto& available = topology.getCpus();
+    for (std::size_t w = 0; w < numThreads; ++w) {
+        int cpu = available[w % available.size()];
+        nodes[w] = topology.getNodeOfCpu(cpu);
+        if (pinThreads) {
+            cpus[w] = cpu;
+        }
+    }
+
+    threads.reserve(numThreads);
+    for (std::size_t w = 0; w < numThreads; ++w) {
+        threads.emplace_back(&SimulationThreadPool::workerLoop, this, w, cpus[w]);
+    }
+
+    // Esperar a que todos los hilos se hayan fijado para que getCpu() sea estable
+    std::unique_lock<std::mutex> lock(mtx);
+    doneCv.wait(lock, [&] { return started == threads.size(); });
+}
+
+SimulationThreadPool::~SimulationThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    startCv.notify_all();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+
+void SimulationThreadPool::runOnAll(const std::function<void(std::size_t)>& task) {
+    std::unique_lock<std::mutex> lock(mtx);
+    currentTask = &task;
+    pending = threads.size();
+    firstError = nullptr;
+    ++generation;
+    startCv.notify_all();
+    doneCv.wait(lock, [this] { return pending == 0; });
+    currentTask = nullptr;
+
+    if (firstError) {
+        std::rethrow_exception(firstError);
+    }
+}
+
+void SimulationThreadPool::workerLoop(std::size_t worker, int cpu) {
+    const bool pinned = cpu >= 0 && NumaTopology::pinCurrentThread(cpu);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        if (!pinned) {
+            cpus[worker] = -1;
+        }
+        ++started;
+    }
+    doneCv.notify_all();
+
+    std::uint64_t seen = 0;
+    while (true) {
+        const std::function<void(std::size_t)>* task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            startCv.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) {
+                return;
+            }
+            seen = generation;
+            task = currentTask;
+        }
+
+        try {
+            (*task)(worker);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (!firstError) {
+                firstError = std::current_exception();
+            }
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            if (--pending == 0) {
+                doneCv.notify_one();
+            }
+        }
+    }
+}
+
+}
@@ -0,0 +1,63 @@
+// src/Parallel/WorkStealingScheduler.cpp
+#include "Parallel/WorkStealingScheduler.h"
+
+namespace BioNeuralNetwork {
+
+WorkStealingScheduler::WorkStealingScheduler(SimulationThreadPool& pool)
+    : pool(pool)
+{
+    for (std::size_t w = 0; w < pool.size(); ++w) {
+        queues.push_back(std::make_unique<WorkerQueue>());
+    }
+}
+
+bool WorkStealingScheduler::popLocal(std::size_t worker, std::size_t& chunk) {
+    WorkerQueue& queue = *queues[worker];
+    std::lock_guard<std::mutex> lock(queue.mtx);
+    if (queue.chunks.empty()) {
+        return false;
+    }
+    chunk = queue.chunks.back();
+    queue.chunks.pop_back();
+    return true;
+}
+
+bool WorkStealingScheduler::steal(std::size_t thief, std::size_t& chunk) {
+    const std::size_t n = queues.size();
+    for (std::size_t k = 1; k < n; ++k) {
+        WorkerQueue& victim = *queues[(thief + k) % n];
+        std::lock_guard<std::mutex> lock(victim.mtx);
+        if (!victim.chunks.empty()) {
+            chunk = victim.chunks.front();
+            victim.chunks.pop_front();
+            stolen.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void WorkStealingScheduler::parallelFor(std::size_t numChunks,
+                                        const std::function<void(std::size_t, std::size_t)>& body)
+{
+    const std::size_t workers = queues.size();
+    for (std::size_t w = 0; w < workers; ++w) {
+        auto& queue = queues[w]->chunks;
+        queue.clear();
+        // Bloques contiguos; el propietario los consume desde el final
+        const std::size_t begin = numChunks * w / workers;
+        const std::size_t end = numChunks * (w + 1) / workers;
+        for (std::size_t c = end; c > begin; --c) {
+            queue.push_back(c - 1);
+        }
+    }
+
+    pool.runOnAll([&](std::size_t worker) {
+        std::size_t chunk;
+        while (popLocal(worker, chunk) || steal(worker, chunk)) {
+            body(worker, chunk);
+        }
+    });
+}
+
+}
@@ -1,8 +1,9 @@
 // src/Synapses/ExcitatorySynapse.cpp
 #include "Synapses/ExcitatorySynapse.h"
-#include "Core/Logger.h" // Incluir el Logger
-#include <sstream>
+#include "Parallel/PlacementArena.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace BioNeuralNetwork {
 
@@ -25,7 +26,8 @@ ExcitatorySynapse::ExcitatorySynapse(std::shared_ptr<INeuron> pre,
       tau_plus(tau_plus),
       tau_minus(tau_minus),
       min_weight(min_weight),
-      max_weight(max_weight)
+      max_weight(max_weight),
+      floorSince(std::numeric_limits<double>::quiet_NaN())
 {
     if (!pre_neuron || !post_neuron) {
         throw std::invalid_argument("Neurona pre o post nula en ExcitatorySynapse.");
@@ -33,10 +35,21 @@ ExcitatorySynapse::ExcitatorySynapse(std::shared_ptr<INeuron> pre,
 }
 
 void ExcitatorySynapse::deliverSpikeFromPre(const std::shared_ptr<INeuron>& pre, double eventTime)
+{
+    transmitFromPre(pre);
+    applyPrePlasticity(pre, eventTime);
+}
+
+void ExcitatorySynapse::transmitFromPre(const std::shared_ptr<INeuron>& pre)
 {
     if (pre == pre_neuron) {
-        post_neuron->injectCurrent(weight);
+        post_neuron->receiveSynapticInput(weight, Receptor::Excitatory);
+    }
+}
 
+void ExcitatorySynapse::applyPrePlasticity(const std::shared_ptr<INeuron>& pre, double eventTime)
+{
+    if (pre == pre_neuron) {
         // STDP
         double preTime = pre_neuron->getLastSpikeTime();
         double postTime = post_neuron->getLastSpikeTime();
@@ -64,8 +77,6 @@ void ExcitatorySynapse::adjustWeight(double delta_t, double eventTime)
         return;
     }
 
-    double oldWeight = weight;
-
     if (delta_t > 0) {
         // LTP
         weight += A_plus * std::exp(-delta_t / tau_plus);
@@ -82,11 +93,55 @@ void ExcitatorySynapse::adjustWeight(double delta_t, double eventTime)
         weight = max_weight;
     }
 
-    if (std::abs(weight - oldWeight) > 1e-6) {
-        std::ostringstream synID;
-        synID << pre_neuron->getID() << "_" << post_neuron->getID();
-        Logger::getInstance().logWeightChange(synID.str(), eventTime, oldWeight, weight);
+    if (weight > min_weight) {
+        floorSince = std::numeric_limits<double>::quiet_NaN();
+    } else if (std::isnan(floorSince)) {
+        floorSince = eventTime;
+    }
+}
+
+double ExcitatorySynapse::weightFloorSince(double now)
+{
+    if (weight > min_weight) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (std::isnan(floorSince)) {
+        floorSince = now;
+    }
+    return floorSince;
+}
+
+void ExcitatorySynapse::setWeight(double newWeight)
+{
+    weight = std::min(std::max(newWeight, min_weight), max_weight);
+    if (weight > min_weight) {
+        floorSince = std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+std::shared_ptr<ISynapse> ExcitatorySynapse::cloneWithEndpoints(std::shared_ptr<INeuron> pre,
+                                                                std::shared_ptr<INeuron> post) const
+{
+    auto copy = std::make_shared<ExcitatorySynapse>(*this);
+    copy->pre_neuron = std::move(pre);
+    copy->post_neuron = std::move(post);
+    if (!copy->pre_neuron || !copy->post_neuron) {
+        throw std::invalid_argument("Neurona pre o post nula en ExcitatorySynapse::cloneWithEndpoints.");
+    }
+    return copy;
+}
+
+std::shared_ptr<ISynapse> ExcitatorySynapse::cloneWithEndpointsInto(std::shared_ptr<INeuron> pre,
+                                                                    std::shared_ptr<INeuron> post,
+                                                                    const std::shared_ptr<PlacementArena>& arena) const
+{
+    if (!pre || !post) {
+        throw std::invalid_argument("Neurona pre o post nula en ExcitatorySynapse::cloneWithEndpointsInto.");
     }
+    auto copy = std::allocate_shared<ExcitatorySynapse>(ArenaAllocator<ExcitatorySynapse>(arena), *this);
+    copy->pre_neuron = std::move(pre);
+    copy->post_neuron = std::move(post);
+    return copy;
 }
 
 }
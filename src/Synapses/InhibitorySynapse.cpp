@@ -1,8 +1,9 @@
 // src/Synapses/InhibitorySynapse.cpp
 #include "Synapses/InhibitorySynapse.h"
-#include "Core/Logger.h" // Incluir el Logger
-#include <sstream>
+#include "Parallel/PlacementArena.h"
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace BioNeuralNetwork {
 
@@ -25,7 +26,8 @@ InhibitorySynapse::InhibitorySynapse(std::shared_ptr<INeuron> pre,
       tau_plus(tau_plus),
       tau_minus(tau_minus),
       min_weight(min_weight),
-      max_weight(max_weight)
+      max_weight(max_weight),
+      floorSince(std::numeric_limits<double>::quiet_NaN())
 {
     if (!pre_neuron || !post_neuron) {
         throw std::invalid_argument("Neurona pre o post nula en InhibitorySynapse.");
@@ -33,16 +35,27 @@ InhibitorySynapse::InhibitorySynapse(std::shared_ptr<INeuron> pre,
 }
 
 void InhibitorySynapse::deliverSpikeFromPre(const std::shared_ptr<INeuron>& pre, double eventTime)
+{
+    transmitFromPre(pre);
+    applyPrePlasticity(pre, eventTime);
+}
+
+void InhibitorySynapse::transmitFromPre(const std::shared_ptr<INeuron>& pre)
 {
     if (pre == pre_neuron) {
-        post_neuron->injectCurrent(-weight);
+        post_neuron->receiveSynapticInput(weight, Receptor::Inhibitory);
+    }
+}
 
+void InhibitorySynapse::applyPrePlasticity(const std::shared_ptr<INeuron>& pre, double eventTime)
+{
+    if (pre == pre_neuron) {
         // STDP
         double preTime = pre_neuron->getLastSpikeTime();
         double postTime = post_neuron->getLastSpikeTime();
         double delta_t = postTime - preTime;
 
-        adjustWeight(delta_t, eventTime); // Pasar eventTime
+        adjustWeight(delta_t, eventTime);
     }
 }
 
@@ -64,8 +77,6 @@ void InhibitorySynapse::adjustWeight(double delta_t, double eventTime) // Añadi
         return;
     }
 
-    double oldWeight = weight; // Guardar el peso antes del ajuste
-
     if (delta_t > 0) {
         // LTP
         weight += A_plus * std::exp(-delta_t / tau_plus);
@@ -83,12 +94,55 @@ void InhibitorySynapse::adjustWeight(double delta_t, double eventTime) // Añadi
         weight = max_weight;
     }
 
+    if (weight > min_weight) {
+        floorSince = std::numeric_limits<double>::quiet_NaN();
+    } else if (std::isnan(floorSince)) {
+        floorSince = eventTime;
+    }
+}
 
-    if (std::abs(weight - oldWeight) > 1e-6) {
-        std::ostringstream synID;
-        synID << pre_neuron->getID() << "_" << post_neuron->getID();
-        Logger::getInstance().logWeightChange(synID.str(), eventTime, oldWeight, weight);
+double InhibitorySynapse::weightFloorSince(double now)
+{
+    if (weight > min_weight) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    if (std::isnan(floorSince)) {
+        floorSince = now;
+    }
+    return floorSince;
+}
+
+void InhibitorySynapse::setWeight(double newWeight)
+{
+    weight = std::min(std::max(newWeight, min_weight), max_weight);
+    if (weight > min_weight) {
+        floorSince = std::numeric_limits<double>::quiet_NaN();
+    }
+}
+
+std::shared_ptr<ISynapse> InhibitorySynapse::cloneWithEndpoints(std::shared_ptr<INeuron> pre,
+                                                                std::shared_ptr<INeuron> post) const
+{
+    auto copy = std::make_shared<InhibitorySynapse>(*this);
+    copy->pre_neuron = std::move(pre);
+    copy->post_neuron = std::move(post);
+    if (!copy->pre_neuron || !copy->post_neuron) {
+        throw std::invalid_argument("Neurona pre o post nula en InhibitorySynapse::cloneWithEndpoints.");
+    }
+    return copy;
+}
+
+std::shared_ptr<ISynapse> InhibitorySynapse::cloneWithEndpointsInto(std::shared_ptr<INeuron> pre,
+                                                                    std::shared_ptr<INeuron> post,
+                                                                    const std::shared_ptr<PlacementArena>& arena) const
+{
+    if (!pre || !post) {
+        throw std::invalid_argument("Neurona pre o post nula en InhibitorySynapse::cloneWithEndpointsInto.");
     }
+    auto copy = std::allocate_shared<InhibitorySynapse>(ArenaAllocator<InhibitorySynapse>(arena), *this);
+    copy->pre_neuron = std::move(pre);
+    copy->post_neuron = std::move(post);
+    return copy;
 }
 
 }
@@ -1,16 +1,77 @@
 #include <iostream>
 #include <filesystem>  // Para crear el directorio de logs, C++17/20
+#include <algorithm>
 
 #include "Network/NetworkManager.h"
 #include "ConnectivityStrategies/RandomConnectivityStrategy.h"
 #include "ConnectivityStrategies/SmallWorldConnectivityStrategy.h"       // <-- Añadido
 #include "ConnectivityStrategies/ScaleFreeConnectivityStrategy.h"        // <-- Añadido
 #include "Core/Logger.h"
+#include "Core/AsyncWriter.h"
 #include "Core/NetworkConfig.h" // <-- Añadido
+#include "Network/SimulationServer.h"
+
+namespace {
+
+    // BioNeuralNetwork --serve <socket> [--workers N] [--cache N] [--output DIR]
+    int runServer(int argc, char** argv) {
+        using namespace BioNeuralNetwork;
+        ServerConfig config;
+        try {
+            if (argc < 3) {
+                throw std::invalid_argument("Falta la ruta del socket.");
+            }
+            config.socketPath = argv[2];
+            for (int i = 3; i + 1 < argc; i += 2) {
+                const std::string flag = argv[i];
+                const std::string value = argv[i + 1];
+                if (flag == "--workers") config.numWorkers = std::stoul(value);
+                else if (flag == "--cache") config.cacheCapacity = std::stoul(value);
+                else if (flag == "--output") config.outputDirectory = value;
+                else throw std::invalid_argument("Opción desconocida: " + flag);
+            }
+            std::filesystem::create_directories(config.outputDirectory);
+
+            SimulationServer server(config);
+            server.start();
+            std::cout << "Servidor escuchando en " << config.socketPath << " con " << config.numWorkers
+                      << " hilos (\"shutdown\" para terminar)\n";
+            server.wait();
+            std::cout << "Servidor detenido tras " << server.getCompletedJobs() << " trabajos.\n";
+        }
+        catch (const std::exception& e) {
+            std::cerr << "Error en el modo servidor: " << e.what() << "\n"
+                      << "Uso: " << argv[0] << " --serve <socket> [--workers N] [--cache N] [--output DIR]\n";
+            return EXIT_FAILURE;
+        }
+        return 0;
+    }
+
+}
 
-int main() {
+int main(int argc, char** argv) {
     using namespace BioNeuralNetwork;
 
+    if (argc > 1 && std::string(argv[1]) == "--serve") {
+        return runServer(argc, argv);
+    }
+
+    // BioNeuralNetwork [--hardware-counters] [--text-log]: perf_event_open y el
+    // log de texto (simulation_logs.txt) solo bajo demanda
+    bool hardwareCounters = false;
+    bool textLog = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::string(argv[i]) == "--hardware-counters") {
+            hardwareCounters = true;
+        } else if (std::string(argv[i]) == "--text-log") {
+            textLog = true;
+        } else {
+            std::cerr << "Opción desconocida: " << argv[i] << "\n"
+                      << "Uso: " << argv[0] << " [--hardware-counters] [--text-log] | --serve <socket> [opciones]\n";
+            return EXIT_FAILURE;
+        }
+    }
+
     std::cout << "=======================================\n";
     std::cout << "      SIMULACION DE RED NEURONAL        \n";
     std::cout << "=======================================\n\n";
@@ -33,7 +94,9 @@ int main() {
     config.inhibitoryConnectivity.defaultWeight = 0.5;
     config.inhibitoryConnectivity.excitatory = false;
 
+    // Las redes no registran nada por defecto: el ejecutable usa el Logger global
     NetworkManager manager;
+    manager.setLogger(&Logger::getInstance());
     try {
         manager.createNetwork(config);
         std::cout << "Red neuronal creada exitosamente.\n\n";
@@ -47,6 +110,31 @@ int main() {
     double dt   = 1.0;
 
     std::cout << "Iniciando simulacion de " << tMax << " ms con paso de " << dt << " ms...\n";
+    if (hardwareCounters) {
+        manager.setHardwareCountersEnabled(true);
+    }
+
+    // Población 0: excitatorias, población 1: inhibitorias (orden de createNetwork)
+    const std::size_t numExcitatory = static_cast<std::size_t>(config.totalNeurons * config.excitatoryRatio);
+    std::vector<std::size_t> populations(manager.getNeurons().size(), 1);
+    std::fill(populations.begin(), populations.begin() + std::min(numExcitatory, populations.size()), 0);
+    manager.enablePopulationStatistics(PopulationStatisticsConfig{}, populations);
+
+    // Los registros se escriben en segundo plano durante la simulación
+    AsyncWriterConfig writerConfig;
+    writerConfig.spikesFile = "output_logs/spikes.csv";
+    writerConfig.weightChangesFile = "output_logs/weight_changes.csv";
+    if (textLog) {
+        writerConfig.textLogFile = "output_logs/simulation_logs.txt";
+    }
+    try {
+        Logger::getInstance().startStreaming(writerConfig);
+    }
+    catch (const std::exception& e) {
+        std::cerr << "Error al abrir los ficheros de registro: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+
     manager.runSimulation(tMax, dt);
     std::cout << "Simulacion completada.\n\n";
 
@@ -56,15 +144,44 @@ int main() {
     std::cout << "Cantidad de spikes registrados: " << spikeCount << "\n";
     std::cout << "Cantidad de cambios de peso registrados: " << weightChangeCount << "\n\n";
 
+    const PopulationStatistics* popStats = manager.getPopulationStatistics();
+    const char* populationNames[] = {"Excitatorias", "Inhibitorias"};
+    std::cout << "Estadisticas de poblacion:\n";
+    for (std::size_t p = 0; p < popStats->getNumPopulations(); ++p) {
+        std::cout << " - " << populationNames[p] << ": tasa " << popStats->getMeanRate(p) << " Hz"
+                  << ", CV ISI " << popStats->getIsiCV(p)
+                  << ", Fano " << popStats->getFanoFactor(p)
+                  << ", sincronia " << popStats->getSynchrony(p) << "\n";
+    }
+    std::cout << "\n";
+
+    const SimulationStats& stats = manager.getStats();
+    std::cout << "Rendimiento:\n";
+    std::cout << " - Actualizaciones de neurona/s: " << stats.neuronUpdatesPerSecond() << "\n";
+    std::cout << " - Eventos sinápticos/s: " << stats.synapticEventsPerSecond() << "\n";
+    std::cout << " - Factor de tiempo real: " << stats.realTimeFactor() << "\n";
+#ifdef BNN_ENABLE_PROFILING
+    for (std::size_t p = 0; p < static_cast<std::size_t>(SimulationPhase::Count); ++p) {
+        auto phase = static_cast<SimulationPhase>(p);
+        std::cout << " - " << toString(phase) << ": "
+                  << manager.getProfiler().getPhaseSeconds(phase) * 1000.0 << " ms\n";
+    }
+#endif
+    if (manager.getHardwareCounters()) {
+        manager.getHardwareCounters()->printReport(std::cout);
+    }
+    std::cout << "\n";
+
     try {
-        Logger::getInstance().exportSpikesToCSV("output_logs/spikes.csv");
-        Logger::getInstance().exportWeightChangesToCSV("output_logs/weight_changes.csv");
-        Logger::getInstance().exportLogsToText("output_logs/simulation_logs.txt");
+        Logger::getInstance().stopStreaming();
 
         std::cout << "Logs exportados exitosamente en la carpeta 'output_logs/'\n";
         std::cout << " - spikes.csv\n";
         std::cout << " - weight_changes.csv\n";
-        std::cout << " - simulation_logs.txt\n\n";
+        if (textLog) {
+            std::cout << " - simulation_logs.txt\n";
+        }
+        std::cout << "\n";
     }
     catch (const std::exception& e) {
         std::cerr << "Error al exportar logs: " << e.what() << "\n";
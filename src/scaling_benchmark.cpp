@@ -0,0 +1,368 @@
+// src/scaling_benchmark.cpp
+//
+// Barrido de escalado fuerte (tamaño fijo, más hilos) y débil (neuronas por hilo
+// fijas) sobre redes creadas con NetworkConfig. Cada configuración se ejecuta en
+// un proceso hijo, de modo que el pico de RSS es el de esa red y una ejecución
+// que supera el tiempo límite se puede cancelar sin perder el resto del barrido.
+// Las estrategias cuya construcción es cuadrática en N (Random y ScaleFree) solo
+// se ejecutan hasta --quadratic-cap neuronas; los tamaños mayores se anotan como
+// "skipped" sin construir la red.
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "Core/NetworkConfig.h"
+#include "Network/NetworkManager.h"
+
+namespace {
+
+    using namespace BioNeuralNetwork;
+
+    struct BenchmarkOptions {
+        std::string mode = "strong";                    // "strong" o "weak"
+        std::vector<long long> sizes = {1000, 10000, 100000, 1000000};
+        long long neuronsPerThread = 10000;             // Solo en modo weak
+        std::vector<std::size_t> threads = {1, 2, 4};
+        std::vector<std::string> strategies = {"Random", "SmallWorld", "ScaleFree"};
+        double duration = 100.0;                        // ms simulados por ejecución
+        double dt = 1.0;
+        double fanOut = 20.0;                           // Sinapsis salientes medias por población (Random)
+        double timeoutSeconds = 600.0;                  // Por ejecución; 0 sin límite
+        long long quadraticCap = 100000;                // Tamaño máximo de Random y ScaleFree; 0 sin límite
+        long long seed = 42;
+        std::string format = "csv";                     // "csv" o "json"
+        std::string output;                             // Vacío: salida estándar
+    };
+
+    // Resultado que el hijo envía al padre por una tubería (tipo trivial)
+    struct RunMeasurements {
+        std::uint64_t neurons = 0;
+        std::uint64_t synapses = 0;
+        double constructionSeconds = 0.0;
+        double placementSeconds = 0.0;                  // Recolocación en memoria al empezar con hilos
+        double wallSeconds = 0.0;
+        double simulatedMs = 0.0;
+        std::int64_t steps = 0;
+        std::uint64_t neuronUpdates = 0;
+        std::uint64_t synapticEvents = 0;
+        long peakRssKb = 0;
+    };
+
+    struct RunResult {
+        std::string strategy;
+        std::size_t threads = 1;
+        long long requestedNeurons = 0;
+        std::string status;                             // "ok", "timeout", "error" o "skipped"
+        RunMeasurements measurements;
+    };
+
+    template <typename T>
+    std::vector<T> parseList(const std::string& text) {
+        std::vector<T> values;
+        std::istringstream stream(text);
+        std::string item;
+        while (std::getline(stream, item, ',')) {
+            if (item.empty()) {
+                continue;
+            }
+            std::istringstream parser(item);
+            T value;
+            if (!(parser >> value)) {
+                throw std::invalid_argument("Valor no válido en la lista: " + item);
+            }
+            values.push_back(value);
+        }
+        return values;
+    }
+
+    void printUsage(const char* program) {
+        std::cerr << "Uso: " << program << " [opciones]\n"
+                  << "  --mode strong|weak            Escalado fuerte o débil (strong)\n"
+                  << "  --sizes N1,N2,...             Tamaños de red en modo strong\n"
+                  << "  --neurons-per-thread N        Neuronas por hilo en modo weak\n"
+                  << "  --threads T1,T2,...           Números de hilos\n"
+                  << "  --strategies S1,S2,...        Random, SmallWorld, ScaleFree\n"
+                  << "  --duration MS                 Tiempo simulado por ejecución\n"
+                  << "  --dt MS                       Paso de integración\n"
+                  << "  --fan-out K                   Sinapsis salientes medias por población en Random\n"
+                  << "  --timeout S                   Límite por ejecución (0: sin límite)\n"
+                  << "  --quadratic-cap N             Tamaño máximo para Random y ScaleFree (0: sin límite)\n"
+                  << "  --seed S                      Semilla de conectividad\n"
+                  << "  --format csv|json             Formato de salida (json: una línea por ejecución)\n"
+                  << "  --output FICHERO              Escribir en un fichero en lugar de stdout\n";
+    }
+
+    BenchmarkOptions parseOptions(int argc, char** argv) {
+        BenchmarkOptions options;
+        for (int i = 1; i < argc; ++i) {
+            const std::string flag = argv[i];
+            if (flag == "--help" || flag == "-h") {
+                printUsage(argv[0]);
+                std::exit(EXIT_SUCCESS);
+            }
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("Falta el valor de " + flag);
+            }
+            const std::string value = argv[++i];
+            if (flag == "--mode") options.mode = value;
+            else if (flag == "--sizes") options.sizes = parseList<long long>(value);
+            else if (flag == "--neurons-per-thread") options.neuronsPerThread = std::stoll(value);
+            else if (flag == "--threads") options.threads = parseList<std::size_t>(value);
+            else if (flag == "--strategies") options.strategies = parseList<std::string>(value);
+            else if (flag == "--duration") options.duration = std::stod(value);
+            else if (flag == "--dt") options.dt = std::stod(value);
+            else if (flag == "--fan-out") options.fanOut = std::stod(value);
+            else if (flag == "--timeout") options.timeoutSeconds = std::stod(value);
+            else if (flag == "--quadratic-cap") options.quadraticCap = std::stoll(value);
+            else if (flag == "--seed") options.seed = std::stoll(value);
+            else if (flag == "--format") options.format = value;
+            else if (flag == "--output") options.output = value;
+            else throw std::invalid_argument("Opción desconocida: " + flag);
+        }
+        if (options.mode != "strong" && options.mode != "weak") {
+            throw std::invalid_argument("El modo debe ser strong o weak.");
+        }
+        if (options.format != "csv" && options.format != "json") {
+            throw std::invalid_argument("El formato debe ser csv o json.");
+        }
+        if (options.duration <= 0.0 || options.dt <= 0.0 || options.fanOut <= 0.0) {
+            throw std::invalid_argument("Duración, paso y fan-out deben ser positivos.");
+        }
+        for (std::size_t t : options.threads) {
+            if (t == 0) {
+                throw std::invalid_argument("El número de hilos debe ser al menos 1.");
+            }
+        }
+        return options;
+    }
+
+    // Random recorre todos los pares y ScaleFree repasa todos los nodos previos por nodo nuevo
+    bool hasQuadraticConstruction(const std::string& strategy) {
+        return strategy == "Random" || strategy == "ScaleFree";
+    }
+
+    NetworkConfig makeConfig(const BenchmarkOptions& options, const std::string& strategy, long long neurons) {
+        NetworkConfig config;
+        config.totalNeurons = static_cast<int>(neurons);
+        config.excitatoryRatio = 0.8;
+        config.inhibitoryRatio = 0.2;
+        config.connectivityStrategy = strategy;
+        config.seed = options.seed;
+
+        // Probabilidad proporcional a 1/N para que el número de sinapsis crezca linealmente
+        const double probability = std::min(1.0, options.fanOut / static_cast<double>(std::max(1LL, neurons)));
+        config.excitatoryConnectivity = {probability, 0.5, true};
+        config.inhibitoryConnectivity = {probability, 0.5, false};
+        return config;
+    }
+
+    // Se ejecuta en el proceso hijo
+    RunMeasurements measureRun(const BenchmarkOptions& options, const std::string& strategy,
+                               long long neurons, std::size_t threads)
+    {
+        RunMeasurements result;
+
+        NetworkManager manager;
+        manager.setLogger(nullptr);   // Sin registro: se mide el motor
+        ParallelConfig parallel;
+        parallel.numThreads = threads;
+        manager.setParallelConfig(parallel);
+
+        const auto start = std::chrono::steady_clock::now();
+        manager.createNetwork(makeConfig(options, strategy, neurons));
+        result.constructionSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        for (const auto& neuron : manager.getNeurons()) {
+            result.synapses += neuron->getOutgoingSynapses().size();
+        }
+        result.neurons = manager.getNeurons().size();
+
+        manager.setTimeStep(options.dt);
+        manager.advance(manager.getCurrentTick() + static_cast<long long>(options.duration / options.dt));
+
+        const SimulationStats& stats = manager.getStats();
+        result.wallSeconds = stats.wallSeconds;
+        result.simulatedMs = stats.simulatedMs;
+        result.steps = stats.steps;
+        result.neuronUpdates = stats.neuronUpdates;
+        result.synapticEvents = stats.synapticEvents;
+        result.placementSeconds = stats.placementSeconds;
+
+        struct rusage usage {};
+        getrusage(RUSAGE_SELF, &usage);
+        result.peakRssKb = usage.ru_maxrss;   // KiB en Linux
+        return result;
+    }
+
+    bool readAll(int fd, void* buffer, std::size_t size) {
+        auto* bytes = static_cast<char*>(buffer);
+        while (size > 0) {
+            const ssize_t n = ::read(fd, bytes, size);
+            if (n <= 0) {
+                return false;
+            }
+            bytes += n;
+            size -= static_cast<std::size_t>(n);
+        }
+        return true;
+    }
+
+    RunResult runIsolated(const BenchmarkOptions& options, const std::string& strategy,
+                          long long neurons, std::size_t threads)
+    {
+        RunResult run;
+        run.strategy = strategy;
+        run.threads = threads;
+        run.requestedNeurons = neurons;
+        if (options.quadraticCap > 0 && neurons > options.quadraticCap && hasQuadraticConstruction(strategy)) {
+            run.status = "skipped";
+            return run;
+        }
+
+        int fds[2];
+        if (pipe(fds) != 0) {
+            throw std::runtime_error("No se pudo crear la tubería del benchmark.");
+        }
+        const pid_t child = fork();
+        if (child < 0) {
+            ::close(fds[0]);
+            ::close(fds[1]);
+            throw std::runtime_error("No se pudo crear el proceso del benchmark.");
+        }
+        if (child == 0) {
+            ::close(fds[0]);
+            int code = EXIT_SUCCESS;
+            try {
+                const RunMeasurements result = measureRun(options, strategy, neurons, threads);
+                if (::write(fds[1], &result, sizeof(result)) != static_cast<ssize_t>(sizeof(result))) {
+                    code = EXIT_FAILURE;
+                }
+            } catch (const std::exception& e) {
+                std::cerr << "Error en " << strategy << " con " << neurons << " neuronas: " << e.what() << "\n";
+                code = EXIT_FAILURE;
+            }
+            ::close(fds[1]);
+            _exit(code);
+        }
+
+        ::close(fds[1]);
+        pollfd descriptor{fds[0], POLLIN, 0};
+        const int timeoutMs = options.timeoutSeconds > 0.0
+            ? static_cast<int>(std::min(options.timeoutSeconds * 1000.0, 2147483647.0)) : -1;
+        const int ready = ::poll(&descriptor, 1, timeoutMs);
+        if (ready == 0) {
+            ::kill(child, SIGKILL);
+            run.status = "timeout";
+        } else {
+            run.status = readAll(fds[0], &run.measurements, sizeof(run.measurements)) ? "ok" : "error";
+        }
+        ::close(fds[0]);
+
+        int status = 0;
+        ::waitpid(child, &status, 0);
+        if (run.status == "ok" && !(WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS)) {
+            run.status = "error";
+        }
+        return run;
+    }
+
+    double perSecond(double count, double seconds) {
+        return seconds > 0.0 ? count / seconds : 0.0;
+    }
+
+    void writeCsvHeader(std::ostream& out) {
+        out << "mode,strategy,threads,requested_neurons,neurons,synapses,status,construction_s,placement_s,wall_s,"
+               "simulated_ms,steps,neuron_updates,synaptic_events,synaptic_events_per_s,"
+               "neuron_updates_per_s,realtime_factor,peak_rss_kb\n";
+    }
+
+    void writeResult(std::ostream& out, const BenchmarkOptions& options, const RunResult& run) {
+        const RunMeasurements& m = run.measurements;
+        const double eventsPerSecond = perSecond(static_cast<double>(m.synapticEvents), m.wallSeconds);
+        const double updatesPerSecond = perSecond(static_cast<double>(m.neuronUpdates), m.wallSeconds);
+        const double realTimeFactor = perSecond(m.simulatedMs / 1000.0, m.wallSeconds);
+
+        out << std::setprecision(9);
+        if (options.format == "csv") {
+            out << options.mode << "," << run.strategy << "," << run.threads << "," << run.requestedNeurons
+                << "," << m.neurons << "," << m.synapses << "," << run.status << "," << m.constructionSeconds
+                << "," << m.placementSeconds << "," << m.wallSeconds << "," << m.simulatedMs << "," << m.steps
+                << "," << m.neuronUpdates << "," << m.synapticEvents << "," << eventsPerSecond << "," << updatesPerSecond
+                << "," << realTimeFactor << "," << m.peakRssKb << "\n";
+        } else {
+            out << "{\"mode\":\"" << options.mode << "\",\"strategy\":\"" << run.strategy
+                << "\",\"threads\":" << run.threads << ",\"requested_neurons\":" << run.requestedNeurons
+                << ",\"neurons\":" << m.neurons << ",\"synapses\":" << m.synapses
+                << ",\"status\":\"" << run.status << "\",\"construction_s\":" << m.constructionSeconds
+                << ",\"placement_s\":" << m.placementSeconds
+                << ",\"wall_s\":" << m.wallSeconds << ",\"simulated_ms\":" << m.simulatedMs
+                << ",\"steps\":" << m.steps << ",\"neuron_updates\":" << m.neuronUpdates
+                << ",\"synaptic_events\":" << m.synapticEvents
+                << ",\"synaptic_events_per_s\":" << eventsPerSecond
+                << ",\"neuron_updates_per_s\":" << updatesPerSecond
+                << ",\"realtime_factor\":" << realTimeFactor
+                << ",\"peak_rss_kb\":" << m.peakRssKb << "}\n";
+        }
+        out.flush();
+    }
+
+}
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    try {
+        options = parseOptions(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n";
+        printUsage(argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    std::ofstream file;
+    if (!options.output.empty()) {
+        file.open(options.output);
+        if (!file.is_open()) {
+            std::cerr << "No se pudo abrir " << options.output << " para escribir.\n";
+            return EXIT_FAILURE;
+        }
+    }
+    std::ostream& out = options.output.empty() ? std::cout : file;
+    if (options.format == "csv") {
+        writeCsvHeader(out);
+    }
+
+    try {
+        for (const auto& strategy : options.strategies) {
+            if (options.mode == "strong") {
+                for (long long size : options.sizes) {
+                    for (std::size_t threads : options.threads) {
+                        writeResult(out, options, runIsolated(options, strategy, size, threads));
+                    }
+                }
+            } else {
+                for (std::size_t threads : options.threads) {
+                    const long long size = options.neuronsPerThread * static_cast<long long>(threads);
+                    writeResult(out, options, runIsolated(options, strategy, size, threads));
+                }
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error en el benchmark: " << e.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
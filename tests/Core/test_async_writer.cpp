@@ -0,0 +1,148 @@
+// tests/Core/test_async_writer.cpp
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Core/AsyncWriter.h"
+#include "Core/Logger.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        std::vector<std::string> readLines(const std::string& filename) {
+            std::ifstream file(filename);
+            std::vector<std::string> lines;
+            for (std::string line; std::getline(file, line);) {
+                lines.push_back(line);
+            }
+            return lines;
+        }
+    }
+
+    // Con bloques pequeños y un solo bloque pendiente, nada se pierde ni se desordena
+    TEST(AsyncWriterTest, WritesEveryRecordInOrderUnderBackPressure) {
+        const std::string filename = "test_async_writer_spikes.csv";
+        AsyncWriterConfig config;
+        config.spikesFile = filename;
+        config.recordsPerBuffer = 7;
+        config.maxPendingBuffers = 1;
+        {
+            AsyncWriter writer(config);
+            for (int i = 0; i < 1000; ++i) {
+                writer.writeSpike(SpikeRecord{i, i * 0.5});
+            }
+            writer.flush();
+            EXPECT_EQ(writer.getSealedBuffers(), writer.getWrittenBuffers());
+            EXPECT_EQ(readLines(filename).size(), 1001u);
+        }
+
+        const auto lines = readLines(filename);
+        ASSERT_EQ(lines.size(), 1001u);
+        EXPECT_EQ(lines[0], "NeuronID,Time(ms)");
+        EXPECT_EQ(lines[1], "0,0.000");
+        EXPECT_EQ(lines[1000], "999,499.500");
+        std::remove(filename.c_str());
+    }
+
+    // En modo streaming el Logger no guarda registros pero sigue contándolos
+    TEST(AsyncWriterTest, LoggerStreamsWeightChanges) {
+        const std::string filename = "test_async_writer_weights.csv";
+        Logger logger;
+        AsyncWriterConfig config;
+        config.weightChangesFile = filename;
+        config.recordsPerBuffer = 2;
+        logger.startStreaming(config);
+        EXPECT_TRUE(logger.isStreaming());
+        EXPECT_THROW(logger.startStreaming(config), std::logic_error);
+
+        for (int i = 0; i < 5; ++i) {
+            logger.logWeightChange("1_2", i, 0.5, 0.6);
+        }
+        logger.logSpike(1, 3.0);   // Sin fichero de spikes: solo se cuenta
+        logger.stopStreaming();
+
+        EXPECT_FALSE(logger.isStreaming());
+        EXPECT_EQ(logger.getWeightChangeCount(), 5);
+        EXPECT_EQ(logger.getSpikeCount(), 1);
+        const auto lines = readLines(filename);
+        ASSERT_EQ(lines.size(), 6u);
+        EXPECT_EQ(lines[5], "1_2,4.000,0.500,0.600");
+        std::remove(filename.c_str());
+    }
+
+    // Cada hilo acumula sus registros y los entrega en bloques de kStagingRecords
+    TEST(AsyncWriterTest, LoggerStagesRecordsPerThread) {
+        const std::string filename = "test_async_writer_staged.csv";
+        Logger logger;
+        AsyncWriterConfig config;
+        config.spikesFile = filename;
+        config.recordsPerBuffer = 1;
+        logger.startStreaming(config);
+
+        // Menos de un bloque por hilo: nada llega al escritor hasta flushStreaming
+        std::thread first([&] { logger.logSpike(1, 1.0); });
+        std::thread second([&] { logger.logSpike(2, 2.0); });
+        first.join();
+        second.join();
+        EXPECT_EQ(logger.getSpikeCount(), 2);
+        EXPECT_LE(readLines(filename).size(), 1u);   // Como mucho la cabecera
+        logger.flushStreaming();
+        EXPECT_EQ(readLines(filename).size(), 3u);
+
+        constexpr int kThreads = 4;
+        constexpr int kPerThread = 1000;
+        std::vector<std::thread> threads;
+        for (int t = 0; t < kThreads; ++t) {
+            threads.emplace_back([&logger, t] {
+                for (int i = 0; i < kPerThread; ++i) {
+                    logger.logSpike(t, i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        logger.stopStreaming();
+
+        EXPECT_EQ(logger.getSpikeCount(), 2 + kThreads * kPerThread);
+        EXPECT_EQ(readLines(filename).size(), 3u + kThreads * kPerThread);
+        std::remove(filename.c_str());
+    }
+
+    // El log de texto sigue el formato de exportLogsToText
+    TEST(AsyncWriterTest, WritesTextLog) {
+        const std::string filename = "test_async_writer_log.txt";
+        Logger logger;
+        AsyncWriterConfig config;
+        config.textLogFile = filename;
+        config.recordsPerBuffer = 2;
+        logger.startStreaming(config);
+        logger.logSpike(3, 1.5);
+        logger.logWeightChange("3_4", 2.0, 0.5, 0.6);
+        logger.logSpike(4, 2.5);
+        logger.stopStreaming();
+
+        const auto lines = readLines(filename);
+        ASSERT_EQ(lines.size(), 6u);
+        EXPECT_EQ(lines[0], "=== LOGS DE SPIKES ===");
+        EXPECT_EQ(lines[1], "Neurona 3 disparó a 1.500 ms");
+        EXPECT_EQ(lines[2], "Neurona 4 disparó a 2.500 ms");
+        EXPECT_EQ(lines[3], "");
+        EXPECT_EQ(lines[4], "=== LOGS DE CAMBIOS DE PESO ===");
+        EXPECT_EQ(lines[5], "Sinapsis 3_4: Peso cambió de 0.500 a 0.600 en 2.000 ms");
+        EXPECT_FALSE(std::ifstream(filename + ".tmp").good());
+        std::remove(filename.c_str());
+    }
+
+    TEST(AsyncWriterTest, RejectsInvalidConfiguration) {
+        AsyncWriterConfig config;
+        config.maxPendingBuffers = 0;
+        EXPECT_THROW(AsyncWriter{config}, std::invalid_argument);
+        config.maxPendingBuffers = AsyncWriter::kMaxPendingBuffers + 1;
+        EXPECT_THROW(AsyncWriter{config}, std::invalid_argument);
+        config.maxPendingBuffers = 2;
+        config.spikesFile = "directorio_inexistente/spikes.csv";
+        EXPECT_THROW(AsyncWriter{config}, std::runtime_error);
+    }
+}
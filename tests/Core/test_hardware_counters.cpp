@@ -0,0 +1,42 @@
+// tests/Core/test_hardware_counters.cpp
+#include <gtest/gtest.h>
+#include <sstream>
+#include "Core/HardwareCounters.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    // Sin permisos para perf_event_open la simulación debe seguir funcionando
+    TEST(HardwareCountersTest, DegradesGracefullyOrCountsCycles) {
+        NetworkManager manager;
+        auto a = manager.createNeuron(NeuronType::Izhikevich);
+        auto b = manager.createNeuron(NeuronType::Izhikevich);
+        manager.connectExcitatory(a, b);
+
+        const bool available = manager.setHardwareCountersEnabled(true);
+        manager.advance(200);
+        EXPECT_EQ(manager.getStats().steps, 200);
+
+        const HardwareCounterProfiler* counters = manager.getHardwareCounters();
+        ASSERT_NE(counters, nullptr);
+        EXPECT_EQ(counters->isAvailable(), available);
+
+        std::ostringstream report;
+        counters->printReport(report);
+        if (!available) {
+            EXPECT_NE(report.str().find("no disponibles"), std::string::npos);
+            return;
+        }
+        EXPECT_NE(report.str().find("Integration"), std::string::npos);
+        if (counters->isSupported(HardwareCounter::Instructions)) {
+            const auto totals = counters->getPhaseTotals(SimulationPhase::Integration);
+            EXPECT_GT(totals[static_cast<std::size_t>(HardwareCounter::Instructions)], 0u);
+        }
+    }
+
+    TEST(HardwareCountersTest, DisabledByDefault) {
+        NetworkManager manager;
+        EXPECT_EQ(manager.getHardwareCounters(), nullptr);
+        EXPECT_FALSE(manager.setHardwareCountersEnabled(false));
+        EXPECT_EQ(manager.getHardwareCounters(), nullptr);
+    }
+}
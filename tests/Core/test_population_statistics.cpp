@@ -0,0 +1,100 @@
+// tests/Core/test_population_statistics.cpp
+#include <gtest/gtest.h>
+#include "Core/Logger.h"
+#include "Core/PopulationStatistics.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    // Dos neuronas que disparan juntas en bins alternos: sincronía total;
+    // si se alternan entre ellas, la actividad de la población es constante
+    TEST(PopulationStatisticsTest, RatesIsiFanoAndSynchrony) {
+        PopulationStatisticsConfig config;
+        config.binWidth = 10.0;
+        config.historyBins = 4;
+        config.isiBinWidth = 5.0;
+        config.isiBins = 10;
+        PopulationStatistics stats(4, {0, 0, 1, 1}, config);
+
+        for (int bin = 0; bin < 100; ++bin) {
+            const double t = bin * 10.0 + 1.0;
+            if (bin % 2 == 0) {
+                stats.recordSpike(0, t);
+                stats.recordSpike(1, t);
+                stats.recordSpike(2, t);
+            } else {
+                stats.recordSpike(3, t);
+            }
+        }
+        stats.advanceTo(1000.0);
+
+        EXPECT_EQ(stats.getClosedBins(), 100);
+        EXPECT_NEAR(stats.getMeanRate(0), 50.0, 1e-9);
+        EXPECT_NEAR(stats.getMeanRate(1), 50.0, 1e-9);
+        EXPECT_NEAR(stats.getSynchrony(0), 1.0, 1e-9);
+        EXPECT_NEAR(stats.getSynchrony(1), 0.0, 1e-9);
+        EXPECT_NEAR(stats.getFanoFactor(0), 1.0, 1e-9);
+        EXPECT_NEAR(stats.getFanoFactor(1), 0.0, 1e-9);
+
+        // ISI de 20 ms siempre: todo en el bin 4 del histograma y CV nulo
+        EXPECT_EQ(stats.getIsiHistogram(0)[4], 98u);
+        EXPECT_NEAR(stats.getMeanIsi(0), 20.0, 1e-9);
+        EXPECT_NEAR(stats.getIsiCV(0), 0.0, 1e-9);
+
+        const auto history = stats.getRateHistory(0);
+        ASSERT_EQ(history.size(), 4u);
+        EXPECT_NEAR(history[2], 100.0, 1e-9);
+        EXPECT_NEAR(history[3], 0.0, 1e-9);
+
+        EXPECT_THROW(stats.recordSpike(0, 5.0), std::invalid_argument);
+    }
+
+    TEST(PopulationStatisticsTest, WorksWithSpikeRecordingOff) {
+        NetworkManager manager;
+        for (int i = 0; i < 10; ++i) {
+            manager.createNeuron(NeuronType::Izhikevich);
+        }
+        manager.enablePopulationStatistics();
+        manager.setLogger(&Logger::getInstance());
+
+        Logger::getInstance().setSpikeRecording(false);
+        const int loggedBefore = Logger::getInstance().getSpikeCount();
+        manager.advance(500);
+        const int loggedAfter = Logger::getInstance().getSpikeCount();
+        Logger::getInstance().setSpikeRecording(true);
+
+        EXPECT_EQ(loggedAfter, loggedBefore);
+        const PopulationStatistics* stats = manager.getPopulationStatistics();
+        ASSERT_NE(stats, nullptr);
+        EXPECT_EQ(stats->getClosedBins(), 50);
+        EXPECT_GT(stats->getMeanRate(0), 0.0);
+    }
+
+    // Las neuronas creadas tras activar las estadísticas se cuentan en vez de fallar
+    TEST(PopulationStatisticsTest, CountsNeuronsAddedAfterEnabling) {
+        for (bool assigned : {false, true}) {
+            NetworkManager manager;
+            manager.setLogger(nullptr);
+            manager.setBackgroundCurrent(0.0);
+            manager.createNeuron(NeuronType::LIF);
+            manager.createNeuron(NeuronType::LIF);
+            manager.enablePopulationStatistics({}, assigned ? std::vector<std::size_t>{0, 1}
+                                                            : std::vector<std::size_t>{});
+            manager.createNeuron(NeuronType::LIF);
+
+            for (long long t = 0; t < 100; ++t) {
+                manager.injectExternalCurrent(2, 800.0);
+                ASSERT_NO_THROW(manager.advance(t + 1));
+            }
+
+            const PopulationStatistics* stats = manager.getPopulationStatistics();
+            const std::size_t added = assigned ? 2 : 0;
+            EXPECT_EQ(stats->getNumPopulations(), assigned ? 3u : 1u);
+            EXPECT_EQ(stats->getPopulationOf(2), added);
+            EXPECT_EQ(stats->getPopulationSize(added), assigned ? 1u : 3u);
+            EXPECT_GT(stats->getMeanRate(added), 0.0);
+            if (assigned) {
+                EXPECT_EQ(stats->getMeanRate(0), 0.0);
+            }
+        }
+    }
+}
@@ -0,0 +1,49 @@
+// tests/Core/test_profiler.cpp
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include "Core/Profiler.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    // Solo las fases de la ventana elegida llegan a la traza, pero todas se acumulan
+    TEST(ProfilerTest, TraceWindowAndTotals) {
+        Profiler profiler;
+        profiler.configure(2);
+        profiler.setTraceWindow(5, 6);
+
+        for (long long tick = 0; tick < 10; ++tick) {
+            ProfileScope scope(profiler, 1, SimulationPhase::Integration, tick);
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+
+        EXPECT_EQ(profiler.getTraceEventCount(), 2u);
+        EXPECT_GT(profiler.getPhaseSeconds(SimulationPhase::Integration, 1), 0.0);
+        EXPECT_EQ(profiler.getPhaseSeconds(SimulationPhase::Integration, 0), 0.0);
+
+        const std::string filename = "profiler_test_trace.json";
+        profiler.exportChromeTrace(filename);
+        std::ifstream file(filename);
+        std::stringstream content;
+        content << file.rdbuf();
+        EXPECT_NE(content.str().find("\"traceEvents\""), std::string::npos);
+        EXPECT_NE(content.str().find("\"name\":\"Integration\""), std::string::npos);
+        std::remove(filename.c_str());
+    }
+
+    TEST(ProfilerTest, NetworkStatsCountUpdates) {
+        NetworkManager manager;
+        auto a = manager.createNeuron(NeuronType::Izhikevich);
+        auto b = manager.createNeuron(NeuronType::Izhikevich);
+        manager.connectExcitatory(a, b);
+        manager.advance(100);
+
+        const auto& stats = manager.getStats();
+        EXPECT_EQ(stats.steps, 100);
+        EXPECT_EQ(stats.neuronUpdates, 200u);
+        EXPECT_GT(stats.synapticEvents, 0u);
+        EXPECT_GT(stats.realTimeFactor(), 0.0);
+    }
+}
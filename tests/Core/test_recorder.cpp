@@ -0,0 +1,118 @@
+// tests/Core/test_recorder.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <vector>
+#include "Core/Logger.h"
+#include "Core/Recorder.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    // Cada red entrega sus eventos solo a sus propios recorders, en el orden de los pasos
+    // (los tiempos de Izhikevich conservan el subpaso en que disparó)
+    TEST(RecorderTest, NetworksFeedTheirOwnRecorders) {
+        NetworkManager first;
+        NetworkManager second;
+        auto firstCounts = std::make_shared<CountingRecorder>();
+        auto secondCounts = std::make_shared<CountingRecorder>();
+        std::vector<double> spikeTimes;
+        for (auto* manager : {&first, &second}) {
+            manager->setLogger(nullptr);
+            auto pre = manager->createNeuron(NeuronType::Izhikevich);
+            auto post = manager->createNeuron(NeuronType::LIF);
+            manager->connectExcitatory(pre, post, 2.0, 1.0);
+        }
+        first.addRecorder(firstCounts);
+        first.addRecorder(std::make_shared<CallbackRecorder>(
+            [&](int, double time) { spikeTimes.push_back(time); }));
+        second.addRecorder(secondCounts);
+
+        first.advance(300);
+        second.advance(100);
+
+        EXPECT_GT(firstCounts->getSpikeCount(), 0u);
+        EXPECT_GT(firstCounts->getWeightChangeCount(), 0u);
+        EXPECT_EQ(firstCounts->getSpikeCount(), first.getRecentSpikes().size());
+        EXPECT_EQ(secondCounts->getSpikeCount(), second.getRecentSpikes().size());
+        EXPECT_LT(secondCounts->getSpikeCount(), firstCounts->getSpikeCount());
+        ASSERT_EQ(spikeTimes.size(), firstCounts->getSpikeCount());
+        for (std::size_t k = 1; k < spikeTimes.size(); ++k) {
+            EXPECT_LE(std::floor(spikeTimes[k - 1]), std::floor(spikeTimes[k]));
+        }
+
+        EXPECT_THROW(first.addRecorder(nullptr), std::invalid_argument);
+        first.clearRecorders();
+        first.advance(400);
+        EXPECT_EQ(firstCounts->getSpikeCount(), spikeTimes.size());
+    }
+
+    // Sin setLogger ni addRecorder una red no registra nada, tampoco en el Logger global
+    TEST(RecorderTest, NetworksRecordNothingByDefault) {
+        NetworkManager manager;
+        EXPECT_EQ(manager.getLogger(), nullptr);
+        auto pre = manager.createNeuron(NeuronType::Izhikevich);
+        auto post = manager.createNeuron(NeuronType::LIF);
+        manager.connectExcitatory(pre, post, 2.0, 1.0);
+
+        const int spikesBefore = Logger::getInstance().getSpikeCount();
+        const int weightChangesBefore = Logger::getInstance().getWeightChangeCount();
+        manager.advance(300);
+        EXPECT_FALSE(manager.getRecentSpikes().empty());
+        EXPECT_EQ(Logger::getInstance().getSpikeCount(), spikesBefore);
+        EXPECT_EQ(Logger::getInstance().getWeightChangeCount(), weightChangesBefore);
+    }
+
+    // Los cambios de peso se registran igual en los bucles en serie y en los repartidos en trozos
+    TEST(RecorderTest, WeightChangesMatchAcrossFanOutPaths) {
+        auto run = [](std::size_t threads) {
+            NetworkManager manager;
+            auto changes = std::make_shared<CountingRecorder>();
+            manager.addRecorder(changes);
+            for (int i = 0; i < 600; ++i) {
+                manager.createNeuron(NeuronType::Izhikevich);
+            }
+            const auto& neurons = manager.getNeurons();
+            for (std::size_t j = 1; j < neurons.size(); ++j) {
+                manager.connectExcitatory(neurons[0], neurons[j], 0.5, 1.0 + (j % 3));
+                manager.connectExcitatory(neurons[j], neurons[0], 0.2);
+            }
+            if (threads > 1) {
+                ParallelConfig parallel;
+                parallel.numThreads = threads;
+                parallel.pinThreads = false;
+                parallel.fanOutChunkSize = 64;
+                manager.setParallelConfig(parallel);
+            }
+            manager.advance(100);
+            return changes->getWeightChangeCount();
+        };
+
+        const std::uint64_t serial = run(1);
+        EXPECT_GT(serial, 0u);
+        EXPECT_EQ(run(3), serial);
+    }
+
+    TEST(RecorderTest, BinaryFileRoundTrip) {
+        const std::string path = "test_recorder_records.bin";
+        {
+            BinaryFileRecorder recorder(path);
+            recorder.recordSpike(7, 12.5);
+            recorder.recordWeightChange(WeightChangeEvent{3, 4, 13.0, 1.0, 1.25});
+            recorder.recordSpike(8, 14.0);
+            recorder.flush();
+        }
+
+        const BinaryRecords records = readBinaryRecords(path);
+        ASSERT_EQ(records.spikes.size(), 2u);
+        EXPECT_EQ(records.spikes[0], std::make_pair(7, 12.5));
+        EXPECT_EQ(records.spikes[1], std::make_pair(8, 14.0));
+        ASSERT_EQ(records.weightChanges.size(), 1u);
+        EXPECT_EQ(records.weightChanges[0].preID, 3);
+        EXPECT_EQ(records.weightChanges[0].postID, 4);
+        EXPECT_DOUBLE_EQ(records.weightChanges[0].newWeight, 1.25);
+        std::remove(path.c_str());
+    }
+
+}
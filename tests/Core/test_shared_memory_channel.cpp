@@ -0,0 +1,137 @@
+// tests/Core/test_shared_memory_channel.cpp
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Core/SpscRing.h"
+#include "Core/SharedMemoryChannel.h"
+#include "Network/ClosedLoopSession.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    // Verificar orden FIFO y límite de capacidad de la cola SPSC
+    TEST(SpscRingTest, PushPopRespectsCapacity) {
+        SpscRing<int, 4> ring;
+        for (int i = 0; i < 4; ++i) {
+            EXPECT_TRUE(ring.tryPush(i));
+        }
+        EXPECT_FALSE(ring.tryPush(99));
+
+        int value = -1;
+        for (int i = 0; i < 4; ++i) {
+            ASSERT_TRUE(ring.tryPop(value));
+            EXPECT_EQ(value, i);
+        }
+        EXPECT_FALSE(ring.tryPop(value));
+    }
+
+    // Un segmento truncado se rechaza aunque empiece por la marca del canal: leer
+    // más allá de su tamaño daría SIGBUS
+    TEST(SharedMemoryChannelTest, OpenRejectsSegmentOfWrongSize) {
+        const std::string name = "/bnn_test_short_" + std::to_string(getpid());
+        int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        ASSERT_GE(fd, 0);
+        const std::uint32_t magic = 0x424E4E43;
+        ASSERT_EQ(write(fd, &magic, sizeof(magic)), static_cast<ssize_t>(sizeof(magic)));
+        close(fd);
+
+        EXPECT_THROW(SharedMemoryChannel::open(name), std::runtime_error);
+        shm_unlink(name.c_str());
+        EXPECT_THROW(SharedMemoryChannel::open(name), std::runtime_error);
+    }
+
+    // Un controlador que abre el canal recibe los spikes provocados por su estímulo
+    TEST(SharedMemoryChannelTest, ClosedLoopRoundTrip) {
+        const std::string name = "/bnn_test_" + std::to_string(getpid());
+        auto simSide = SharedMemoryChannel::create(name);
+        auto controller = SharedMemoryChannel::open(name);
+
+        NetworkManager manager;
+        manager.createNeuron(NeuronType::LIF);
+        manager.createNeuron(NeuronType::LIF);
+        manager.setBackgroundCurrent(0.0);
+
+        ASSERT_TRUE(controller.stimulus().tryPush(StimulusMessage{3, 1, 1015.0f}));
+
+        ClosedLoopSession session(manager, simSide);
+        session.run(5);
+
+        EXPECT_EQ(controller.completedTick(), 4);
+        SpikeMessage spike{};
+        ASSERT_TRUE(controller.spikes().tryPop(spike));
+        EXPECT_EQ(spike.neuronIndex, 1);
+        EXPECT_EQ(spike.tick, 3);
+        EXPECT_FALSE(controller.spikes().tryPop(spike));
+    }
+
+    // Un controlador en otro proceso envía un estímulo por paso y espera su cierre:
+    // la mediana del ciclo completo (estímulo, paso de simulación, spikes) queda bajo 100 µs
+    TEST(SharedMemoryChannelTest, PerStepRoundTripUnder100Microseconds) {
+        const std::string name = "/bnn_latency_" + std::to_string(getpid());
+        auto simSide = SharedMemoryChannel::create(name);
+        const long long steps = 2000;
+
+        int fds[2];
+        ASSERT_EQ(pipe(fds), 0);
+        pid_t pid = fork();
+        ASSERT_GE(pid, 0);
+        if (pid == 0) {
+            close(fds[0]);
+            auto controller = SharedMemoryChannel::open(name);
+            std::vector<double> latencies;
+            latencies.reserve(steps);
+            SpikeMessage spike{};
+            for (long long t = 0; t < steps; ++t) {
+                const auto start = std::chrono::steady_clock::now();
+                controller.stimulus().tryPush(StimulusMessage{t, static_cast<std::int32_t>(t % 64), 1015.0f});
+                while (controller.completedTick() < t) {
+                    sched_yield();
+                }
+                while (controller.spikes().tryPop(spike)) {
+                }
+                latencies.push_back(std::chrono::duration<double, std::micro>(
+                    std::chrono::steady_clock::now() - start).count());
+            }
+            std::nth_element(latencies.begin(), latencies.begin() + steps / 2, latencies.end());
+            const double median = latencies[steps / 2];
+            const bool written = write(fds[1], &median, sizeof(median)) == sizeof(median);
+            close(fds[1]);
+            _exit(written ? 0 : 2);
+        }
+        close(fds[1]);
+
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (int i = 0; i < 64; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        manager.setBackgroundCurrent(0.0);
+
+        // El simulador avanza un paso solo cuando llega el estímulo de ese paso
+        ClosedLoopSession session(manager, simSide);
+        for (long long t = 0; t < steps; ++t) {
+            while (simSide.stimulus().empty()) {
+                sched_yield();
+            }
+            session.run(t + 1);
+        }
+
+        double median = 0.0;
+        EXPECT_EQ(read(fds[0], &median, sizeof(median)), static_cast<ssize_t>(sizeof(median)));
+        close(fds[0]);
+        int status = 0;
+        waitpid(pid, &status, 0);
+        ASSERT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+        EXPECT_EQ(session.getDroppedSpikes(), 0u);
+        EXPECT_GT(median, 0.0);
+        EXPECT_LT(median, 100.0);
+    }
+}
@@ -0,0 +1,127 @@
+// tests/Core/test_state_probe.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        void buildPair(NetworkManager& manager) {
+            manager.setLogger(nullptr);
+            auto a = manager.createNeuron(NeuronType::Izhikevich);
+            auto b = manager.createNeuron(NeuronType::Izhikevich);
+            manager.connectExcitatory(a, b, 5.0, 2.0);
+        }
+    }
+
+    // Las muestras volcadas por bloques coinciden con leer V paso a paso
+    TEST(StateProbeTest, BinaryFileMatchesPolledPotential) {
+        const std::string filename = "test_state_probe.bin";
+        NetworkManager probed;
+        NetworkManager polled;
+        buildPair(probed);
+        buildPair(polled);
+
+        ProbeConfig config;
+        config.neurons = {1, 0};
+        config.samplingInterval = 3;
+        config.bufferSamples = 4;
+        config.filename = filename;
+        const std::size_t id = probed.addProbe(config);
+
+        std::vector<double> expected;
+        for (long long tick = 0; tick < 30; ++tick) {
+            polled.advance(tick + 1);
+            if (tick % 3 == 0) {
+                expected.push_back(polled.getNeurons()[1]->getMembranePotential());
+                expected.push_back(polled.getNeurons()[0]->getMembranePotential());
+            }
+        }
+        probed.advance(30);
+        probed.flushProbes();
+        EXPECT_EQ(probed.getProbe(id).getSampleCount(), 10u);
+
+        const ProbeRecording recording = StateProbe::readFile(filename);
+        ASSERT_EQ(recording.ticks.size(), 10u);
+        ASSERT_EQ(recording.getNumTargets(), 2u);
+        for (std::size_t s = 0; s < recording.ticks.size(); ++s) {
+            EXPECT_EQ(recording.ticks[s], static_cast<long long>(3 * s));
+            EXPECT_DOUBLE_EQ(recording.at(s, 0), expected[2 * s]);
+            EXPECT_DOUBLE_EQ(recording.at(s, 1), expected[2 * s + 1]);
+        }
+        std::remove(filename.c_str());
+    }
+
+    // Sin fichero el bloque se conserva en memoria y lo que no cabe se descarta
+    TEST(StateProbeTest, InMemoryWeightProbeDropsOverflow) {
+        NetworkManager manager;
+        buildPair(manager);
+
+        ProbeConfig config;
+        config.variable = ProbeVariable::SynapticWeight;
+        config.synapses = {{0, 1}, {1, 0}};
+        config.bufferSamples = 5;
+        StateProbe& probe = manager.getProbe(manager.addProbe(config));
+
+        manager.advance(8);
+        EXPECT_EQ(probe.getBufferedSamples(), 5u);
+        EXPECT_EQ(probe.getDroppedSamples(), 3u);
+        EXPECT_DOUBLE_EQ(probe.getBufferedValues()[0], 5.0);
+        EXPECT_TRUE(std::isnan(probe.getBufferedValues()[1]));  // No existe 1 -> 0
+    }
+
+
+    // Tras reordenar la red, las sondas siguen las mismas neuronas y sinapsis
+    TEST(StateProbeTest, ReorderKeepsProbeTargets) {
+        const std::size_t n = 32;
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (std::size_t i = 0; i < n; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        const auto neurons = manager.getNeurons();
+        for (std::size_t i = 0; i < n; ++i) {
+            manager.connectExcitatory(neurons[(i * 13) % n], neurons[((i + 1) * 13) % n], 0.1 * (i + 1));
+        }
+
+        ProbeConfig potentials;
+        potentials.neurons = {3, 17, 30};
+        ProbeConfig weights;
+        weights.variable = ProbeVariable::SynapticWeight;
+        weights.synapses = {{0, 13}, {13, 26}};
+        const std::size_t potentialId = manager.addProbe(potentials);
+        const std::size_t weightId = manager.addProbe(weights);
+
+        manager.reorderNeurons(NeuronOrdering::ReverseCuthillMcKee);
+        for (std::size_t i = 0; i < n; ++i) {
+            manager.injectExternalCurrent(i, 10.0 * static_cast<double>(manager.getOriginalIndex(i)));
+        }
+        manager.advance(1);
+
+        auto newIndexOf = [&](std::size_t original) {
+            for (std::size_t i = 0; i < n; ++i) {
+                if (manager.getOriginalIndex(i) == original) {
+                    return i;
+                }
+            }
+            return n;
+        };
+        const StateProbe& potentialProbe = manager.getProbe(potentialId);
+        ASSERT_EQ(potentialProbe.getBufferedSamples(), 1u);
+        for (std::size_t k = 0; k < potentials.neurons.size(); ++k) {
+            const std::size_t index = newIndexOf(potentials.neurons[k]);
+            EXPECT_EQ(potentialProbe.getConfig().neurons[k], index);
+            EXPECT_EQ(manager.getNeurons()[index]->getID(), neurons[potentials.neurons[k]]->getID());
+            EXPECT_EQ(potentialProbe.getBufferedValues()[k], manager.getNeurons()[index]->getMembranePotential());
+        }
+        const StateProbe& weightProbe = manager.getProbe(weightId);
+        for (std::size_t k = 0; k < weights.synapses.size(); ++k) {
+            const double weight = manager.getSynapseWeight(newIndexOf(weights.synapses[k].first),
+                                                           newIndexOf(weights.synapses[k].second));
+            EXPECT_EQ(weightProbe.getBufferedValues()[k], weight);
+        }
+        EXPECT_NE(weightProbe.getBufferedValues()[0], weightProbe.getBufferedValues()[1]);
+    }
+}
@@ -0,0 +1,64 @@
+// tests/Core/test_synaptic_kernel.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include "Core/SynapticKernel.h"
+#include "Neurons/LIFNeuron.h"
+
+namespace BioNeuralNetwork {
+
+    TEST(SynapticKernelTest, ExponentialStateDecaysPerReceptor) {
+        SynapticModel model;
+        model.dynamics = SynapseDynamics::ExponentialCurrent;
+        model.tauExcitatory = 5.0;
+        model.tauInhibitory = 10.0;
+        SynapticKernel kernel;
+        kernel.setModel(model);
+
+        kernel.receive(2.0, Receptor::Excitatory);
+        kernel.receive(1.0, Receptor::Inhibitory);
+        EXPECT_DOUBLE_EQ(kernel.current(-65.0), 1.0);
+
+        kernel.decay(1.0);
+        EXPECT_DOUBLE_EQ(kernel.getExcitatory(), 2.0 * std::exp(-1.0 / 5.0));
+        EXPECT_DOUBLE_EQ(kernel.getInhibitory(), std::exp(-1.0 / 10.0));
+
+        // Sin entradas el estado termina anulándose
+        for (int step = 0; step < 1000; ++step) {
+            kernel.decay(1.0);
+        }
+        EXPECT_TRUE(kernel.isIdle());
+    }
+
+    TEST(SynapticKernelTest, ConductanceDependsOnMembranePotential) {
+        SynapticModel model;
+        model.dynamics = SynapseDynamics::ExponentialConductance;
+        SynapticKernel kernel;
+        kernel.setModel(model);
+
+        kernel.receive(0.5, Receptor::Excitatory);
+        EXPECT_DOUBLE_EQ(kernel.current(-60.0), 0.5 * (model.reversalExcitatory + 60.0));
+        EXPECT_DOUBLE_EQ(kernel.current(model.reversalExcitatory), 0.0);
+    }
+
+    // Un solo spike excitador sigue despolarizando durante varios pasos
+    TEST(SynapticKernelTest, LifIntegratesDecayingCurrent) {
+        LIFNeuron instantaneous;
+        LIFNeuron exponential;
+        SynapticModel model;
+        model.dynamics = SynapseDynamics::ExponentialCurrent;
+        exponential.setSynapticModel(model);
+
+        instantaneous.receiveSynapticInput(0.2, Receptor::Excitatory);
+        exponential.receiveSynapticInput(0.2, Receptor::Excitatory);
+        instantaneous.stepSimulation(1.0, 0.0);
+        exponential.stepSimulation(1.0, 0.0);
+        EXPECT_DOUBLE_EQ(exponential.getPotential(), instantaneous.getPotential());
+
+        const double afterFirst = exponential.getPotential();
+        exponential.stepSimulation(1.0, 1.0);
+        instantaneous.stepSimulation(1.0, 1.0);
+        EXPECT_GT(exponential.getPotential(), afterFirst);
+        EXPECT_LT(instantaneous.getPotential(), afterFirst);
+    }
+
+}
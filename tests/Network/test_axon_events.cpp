@@ -0,0 +1,89 @@
+// tests/Network/test_axon_events.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    // Un spike de una neurona con muchas sinapsis ocupa un evento por retardo distinto
+    TEST(AxonEventTest, OneQueuedEventPerDelayBucket) {
+        NetworkManager manager;
+        manager.setBackgroundCurrent(0.0);
+        auto hub = manager.createNeuron(NeuronType::LIF);
+        const double delays[] = {2.0, 3.0, 5.0};
+        for (int t = 0; t < 300; ++t) {
+            auto target = manager.createNeuron(NeuronType::LIF);
+            manager.connectExcitatory(hub, target, 0.1, delays[t % 3]);
+        }
+
+        manager.injectExternalCurrent(0, 800.0);
+        std::size_t maxQueued = 0;
+        for (int step = 0; step < 10; ++step) {
+            manager.advance(manager.getCurrentTick() + 1);
+            maxQueued = std::max(maxQueued, manager.getQueuedEventCount());
+        }
+
+        EXPECT_EQ(maxQueued, 3u);
+        EXPECT_EQ(manager.getQueuedEventCount(), 0u);
+        EXPECT_EQ(manager.getStats().synapticEvents, 300u);
+    }
+
+    // Con hilos, los grupos de varios hubs se entregan repartidos por la partición de
+    // la neurona post y el resultado (spikes, pesos y potenciales) es el de la ejecución en serie
+    TEST(AxonEventTest, ThreadedHubDeliveryMatchesSequential) {
+        struct Result {
+            std::vector<std::pair<long long, std::size_t>> spikes;
+            std::vector<double> weights;
+            std::vector<double> potentials;
+        };
+        auto run = [](std::size_t threads) {
+            NetworkManager manager;
+            manager.setLogger(nullptr);
+            for (int i = 0; i < 800; ++i) {
+                manager.createNeuron(NeuronType::Izhikevich);
+            }
+            const auto& neurons = manager.getNeurons();
+            for (std::size_t hub = 0; hub < 4; ++hub) {
+                for (std::size_t j = 4; j < neurons.size(); ++j) {
+                    manager.connectExcitatory(neurons[hub], neurons[j], 0.6, 1.0 + static_cast<double>((j + hub) % 4));
+                }
+            }
+            for (std::size_t j = 4; j < neurons.size(); ++j) {
+                manager.connectExcitatory(neurons[j], neurons[j % 4], 0.3, 2.0);
+                manager.connectInhibitory(neurons[j], neurons[(j * 7) % neurons.size()], 0.4, 1.0);
+            }
+            if (threads > 1) {
+                ParallelConfig parallel;
+                parallel.numThreads = threads;
+                parallel.pinThreads = false;
+                parallel.fanOutChunkSize = 32;
+                manager.setParallelConfig(parallel);
+            }
+
+            Result result;
+            for (long long chunk = 1; chunk <= 5; ++chunk) {
+                manager.advance(chunk * 40);
+                for (const auto& spike : manager.getRecentSpikes()) {
+                    result.spikes.emplace_back(spike.tick, spike.neuronIndex);
+                }
+            }
+            for (const auto& neuron : manager.getNeurons()) {
+                result.potentials.push_back(neuron->getPotential());
+                for (const auto& synapse : neuron->getOutgoingSynapses()) {
+                    result.weights.push_back(synapse->getWeight());
+                }
+            }
+            EXPECT_GT(manager.getStats().synapticEvents, 20000u);
+            return result;
+        };
+
+        const Result sequential = run(1);
+        const Result threaded = run(4);
+        ASSERT_FALSE(sequential.spikes.empty());
+        EXPECT_EQ(threaded.spikes, sequential.spikes);
+        EXPECT_EQ(threaded.weights, sequential.weights);
+        EXPECT_EQ(threaded.potentials, sequential.potentials);
+    }
+
+}
@@ -0,0 +1,145 @@
+// tests/Network/test_dense_delivery.cpp
+#include <gtest/gtest.h>
+#include <memory>
+#include <random>
+#include <vector>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    namespace {
+
+        // Red recurrente muy activa con retardos enteros de 1 a 4 ms
+        std::unique_ptr<NetworkManager> buildBurstingNetwork(DeliveryMode mode) {
+            auto manager = std::make_unique<NetworkManager>();
+            manager->setLogger(nullptr);
+            manager->setBackgroundCurrent(14.0);
+            manager->setDeliveryMode(mode);
+            std::mt19937 rng(3);
+            std::uniform_int_distribution<std::size_t> pick(0, 299);
+            std::uniform_int_distribution<int> delay(1, 4);
+            for (int i = 0; i < 300; ++i) {
+                manager->createNeuron(NeuronType::Izhikevich);
+            }
+            const auto& neurons = manager->getNeurons();
+            for (std::size_t pre = 0; pre < neurons.size(); ++pre) {
+                for (int k = 0; k < 20; ++k) {
+                    if (pre % 4 == 0) {
+                        manager->connectInhibitory(neurons[pre], neurons[pick(rng)], 1.0, delay(rng));
+                    } else {
+                        manager->connectExcitatory(neurons[pre], neurons[pick(rng)], 0.8, delay(rng));
+                    }
+                }
+            }
+            return manager;
+        }
+
+        struct Trace {
+            std::vector<std::pair<long long, std::size_t>> spikes;
+            std::vector<double> weights;
+        };
+
+        Trace run(NetworkManager& manager, const std::vector<std::pair<long long, DeliveryMode>>& schedule) {
+            Trace trace;
+            for (const auto& [untilTick, mode] : schedule) {
+                manager.setDeliveryMode(mode);
+                manager.advance(untilTick);
+                for (const auto& spike : manager.getRecentSpikes()) {
+                    trace.spikes.emplace_back(spike.tick, spike.neuronIndex);
+                }
+            }
+            for (const auto& neuron : manager.getNeurons()) {
+                for (const auto& synapse : neuron->getOutgoingSynapses()) {
+                    trace.weights.push_back(synapse->getWeight());
+                }
+            }
+            return trace;
+        }
+
+    }
+
+    // Con retardos múltiplos de dt, bitset, cola y modo adaptativo entregan lo mismo en el mismo orden
+    TEST(DenseDeliveryTest, MatchesEventDelivery) {
+        auto events = buildBurstingNetwork(DeliveryMode::Events);
+        auto dense = buildBurstingNetwork(DeliveryMode::Dense);
+        auto adaptive = buildBurstingNetwork(DeliveryMode::Adaptive);
+
+        const Trace expected = run(*events, {{200, DeliveryMode::Events}});
+        const Trace denseTrace = run(*dense, {{200, DeliveryMode::Dense}});
+        const Trace adaptiveTrace = run(*adaptive, {{200, DeliveryMode::Adaptive}});
+
+        ASSERT_GT(expected.spikes.size(), 1000u);
+        EXPECT_EQ(denseTrace.spikes, expected.spikes);
+        EXPECT_EQ(denseTrace.weights, expected.weights);
+        EXPECT_EQ(adaptiveTrace.spikes, expected.spikes);
+        EXPECT_EQ(adaptiveTrace.weights, expected.weights);
+        EXPECT_EQ(dense->getStats().synapticEvents, events->getStats().synapticEvents);
+        EXPECT_EQ(events->getStats().denseDeliverySteps, 0);
+        EXPECT_GT(dense->getStats().denseDeliverySteps, 0);
+        EXPECT_GT(adaptive->getStats().denseDeliverySteps, 0);
+        EXPECT_LE(adaptive->getStats().denseDeliverySteps, dense->getStats().denseDeliverySteps);
+    }
+
+    // Con 100 retardos distintos, cada llegada recorre los grupos de su retardo: con
+    // pocos spikes por paso conviene la cola y con muchos el bitset
+    TEST(DenseDeliveryTest, AdaptiveChoiceAccountsForDelayBuckets) {
+        auto run = [](DeliveryMode mode, std::size_t spikesPerStep, NetworkManager& manager) {
+            manager.setLogger(nullptr);
+            manager.setBackgroundCurrent(0.0);
+            manager.setDeliveryMode(mode);
+            std::mt19937 rng(9);
+            std::uniform_int_distribution<std::size_t> pick(0, 1023);
+            std::uniform_int_distribution<int> delay(1, 100);
+            for (int i = 0; i < 1024; ++i) {
+                manager.createNeuron(NeuronType::LIF);
+            }
+            for (std::size_t pre = 0; pre < 1024; ++pre) {
+                for (int k = 0; k < 16; ++k) {
+                    manager.connectIfAbsent(pre, pick(rng), 0.1, delay(rng), true);
+                }
+            }
+            // spikesPerStep neuronas distintas disparan en cada paso
+            std::vector<std::pair<long long, std::size_t>> spikes;
+            for (long long t = 0; t < 200; ++t) {
+                for (std::size_t k = 0; k < spikesPerStep; ++k) {
+                    manager.injectExternalCurrent((static_cast<std::size_t>(t) * 7919 + k * 3) % 1024, 800.0);
+                }
+                manager.advance(t + 1);
+                for (const auto& spike : manager.getRecentSpikes()) {
+                    spikes.emplace_back(spike.tick, spike.neuronIndex);
+                }
+            }
+            return spikes;
+        };
+
+        for (std::size_t spikesPerStep : {15u, 300u}) {
+            NetworkManager events;
+            NetworkManager adaptive;
+            const auto expected = run(DeliveryMode::Events, spikesPerStep, events);
+            const auto chosen = run(DeliveryMode::Adaptive, spikesPerStep, adaptive);
+            EXPECT_EQ(chosen, expected);
+            EXPECT_EQ(adaptive.getStats().synapticEvents, events.getStats().synapticEvents);
+            if (spikesPerStep == 15u) {
+                EXPECT_EQ(adaptive.getStats().denseDeliverySteps, 0);
+            } else {
+                EXPECT_GT(adaptive.getStats().denseDeliverySteps, 150);
+            }
+        }
+    }
+
+    // Al volver a la cola, los spikes pendientes del bitset se convierten en eventos
+    TEST(DenseDeliveryTest, SwitchingModesKeepsSpikesInFlight) {
+        auto events = buildBurstingNetwork(DeliveryMode::Events);
+        auto switching = buildBurstingNetwork(DeliveryMode::Dense);
+
+        const Trace expected = run(*events, {{150, DeliveryMode::Events}});
+        const Trace switched = run(*switching, {{50, DeliveryMode::Dense},
+                                                {100, DeliveryMode::Events},
+                                                {150, DeliveryMode::Dense}});
+
+        EXPECT_EQ(switched.spikes, expected.spikes);
+        EXPECT_EQ(switched.weights, expected.weights);
+        EXPECT_EQ(switching->getStats().synapticEvents, events->getStats().synapticEvents);
+    }
+
+}
@@ -0,0 +1,203 @@
+// tests/Network/test_distributed_simulation.cpp
+#include <gtest/gtest.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <random>
+#include <utility>
+#include <vector>
+#include "Network/NetworkManager.h"
+#include "Network/UnixSocketTransport.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        NetworkConfig distributedTestConfig() {
+            NetworkConfig config;
+            config.totalNeurons = 40;
+            config.excitatoryRatio = 0.8;
+            config.inhibitoryRatio = 0.2;
+            config.connectivityStrategy = "Random";
+            config.excitatoryConnectivity = {0.2, 3.0, true};
+            config.inhibitoryConnectivity = {0.2, 2.0, false};
+            config.seed = 1234;
+            return config;
+        }
+
+        using SpikeList = std::vector<std::pair<long long, std::size_t>>;
+        using Record = std::array<long long, 3>;
+
+        SpikeList simulate(NetworkManager& manager, long long ticks) {
+            manager.createNetwork(distributedTestConfig());
+            manager.advance(ticks);
+            SpikeList spikes;
+            for (const auto& s : manager.getRecentSpikes()) {
+                spikes.emplace_back(s.tick, s.neuronIndex);
+            }
+            return spikes;
+        }
+
+        // Ejecuta body en un proceso por rank y reúne los registros que devuelve cada uno
+        std::vector<Record> runRanks(int ranks,
+                                     const std::function<std::vector<Record>(std::shared_ptr<ISpikeTransport>)>& body) {
+            auto group = UnixSocketTransport::createLocalGroup(ranks);
+            std::vector<int> readFds;
+            std::vector<pid_t> children;
+
+            for (int r = 0; r < ranks; ++r) {
+                int fds[2];
+                EXPECT_EQ(pipe(fds), 0);
+                pid_t pid = fork();
+                EXPECT_GE(pid, 0);
+                if (pid == 0) {
+                    close(fds[0]);
+                    std::shared_ptr<UnixSocketTransport> own = std::move(group[r]);
+                    group.clear();
+
+                    for (const Record& record : body(own)) {
+                        if (write(fds[1], record.data(), sizeof(record)) != sizeof(record)) {
+                            _exit(2);
+                        }
+                    }
+                    close(fds[1]);
+                    _exit(0);
+                }
+                close(fds[1]);
+                readFds.push_back(fds[0]);
+                children.push_back(pid);
+            }
+            group.clear();
+
+            std::vector<Record> records;
+            for (int fd : readFds) {
+                Record record;
+                while (read(fd, record.data(), sizeof(record)) == sizeof(record)) {
+                    records.push_back(record);
+                }
+                close(fd);
+            }
+            for (pid_t pid : children) {
+                int status = 0;
+                waitpid(pid, &status, 0);
+                EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+            }
+            return records;
+        }
+
+        // Red recurrente con retardos de 2 a 4 ms (ventanas de dos pasos) y STDP
+        void buildDelayedNetwork(NetworkManager& manager) {
+            manager.setLogger(nullptr);
+            std::mt19937 rng(11);
+            std::uniform_int_distribution<std::size_t> pick(0, 59);
+            std::uniform_int_distribution<int> delay(2, 4);
+            for (int i = 0; i < 60; ++i) {
+                manager.createNeuron(NeuronType::Izhikevich);
+            }
+            for (std::size_t pre = 0; pre < 60; ++pre) {
+                for (int k = 0; k < 8; ++k) {
+                    const std::size_t post = pick(rng);
+                    const int d = delay(rng);
+                    if (pre % 5 == 0) {
+                        manager.connectIfAbsent(pre, post, 2.0, d, false);
+                    } else {
+                        manager.connectIfAbsent(pre, post, 3.0, d, true);
+                    }
+                }
+            }
+        }
+
+        // Spikes {0, paso, neurona} y pesos {1, pre * 1000 + post, bits del peso}
+        std::vector<Record> delayedRecords(NetworkManager& manager) {
+            std::vector<Record> records;
+            for (long long chunk = 1; chunk <= 6; ++chunk) {
+                manager.advance(chunk * 50);
+                for (const auto& s : manager.getRecentSpikes()) {
+                    if (manager.isLocalNeuron(s.neuronIndex)) {
+                        records.push_back({0, s.tick, static_cast<long long>(s.neuronIndex)});
+                    }
+                }
+            }
+            const auto& neurons = manager.getNeurons();
+            for (std::size_t pre = 0; pre < neurons.size(); ++pre) {
+                for (std::size_t post = 0; post < neurons.size(); ++post) {
+                    if (!manager.isLocalNeuron(post) || !manager.isConnected(pre, post)) {
+                        continue;
+                    }
+                    const double weight = manager.getSynapseWeight(pre, post);
+                    long long bits = 0;
+                    std::memcpy(&bits, &weight, sizeof(bits));
+                    records.push_back({1, static_cast<long long>(pre * 1000 + post), bits});
+                }
+            }
+            return records;
+        }
+    }
+
+    // Dos procesos con la red particionada deben reproducir los spikes de un único proceso
+    TEST(DistributedSimulationTest, MatchesSingleProcessRun) {
+        const int ranks = 2;
+        const long long ticks = 200;
+
+        std::vector<Record> records = runRanks(ranks, [&](std::shared_ptr<ISpikeTransport> transport) {
+            NetworkManager manager;
+            manager.setSpikeTransport(transport);
+            std::vector<Record> spikes;
+            for (const auto& s : simulate(manager, ticks)) {
+                spikes.push_back({s.first, static_cast<long long>(s.second), 0});
+            }
+            return spikes;
+        });
+        SpikeList distributed;
+        for (const Record& record : records) {
+            distributed.emplace_back(record[0], static_cast<std::size_t>(record[1]));
+        }
+
+        NetworkManager single;
+        SpikeList reference = simulate(single, ticks);
+
+        std::sort(distributed.begin(), distributed.end());
+        std::sort(reference.begin(), reference.end());
+        EXPECT_FALSE(reference.empty());
+        EXPECT_EQ(distributed, reference);
+    }
+
+    // Con retardos mayores que dt el STDP de cada ventana se rehace tras el intercambio con
+    // el paso real de cada spike: spikes y pesos coinciden bit a bit con un solo proceso
+    TEST(DistributedSimulationTest, DelayedWindowsMatchSingleProcessBitForBit) {
+        std::vector<Record> distributed = runRanks(3, [](std::shared_ptr<ISpikeTransport> transport) {
+            NetworkManager manager;
+            manager.setSpikeTransport(transport);
+            buildDelayedNetwork(manager);
+            std::vector<Record> records = delayedRecords(manager);
+            if (manager.getExchangeWindowSteps() != 2) {
+                _exit(3);
+            }
+            return records;
+        });
+
+        NetworkManager single;
+        buildDelayedNetwork(single);
+        ParallelConfig windows;
+        windows.minDelayWindows = true;
+        single.setParallelConfig(windows);
+        std::vector<Record> reference = delayedRecords(single);
+
+        std::sort(distributed.begin(), distributed.end());
+        std::sort(reference.begin(), reference.end());
+        const auto spikes = std::count_if(reference.begin(), reference.end(),
+                                          [](const Record& r) { return r[0] == 0; });
+        EXPECT_GT(spikes, 100);
+        EXPECT_EQ(single.getExchangeWindowSteps(), 2);
+        EXPECT_EQ(distributed, reference);
+
+        // El STDP ha modificado los pesos
+        const auto changed = std::count_if(reference.begin(), reference.end(), [](const Record& r) {
+            double weight = 0.0;
+            std::memcpy(&weight, &r[2], sizeof(weight));
+            return r[0] == 1 && weight != 2.0 && weight != 3.0;
+        });
+        EXPECT_GT(changed, 0);
+    }
+}
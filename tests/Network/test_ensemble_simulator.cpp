@@ -0,0 +1,151 @@
+// tests/Network/test_ensemble_simulator.cpp
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "Network/EnsembleSimulator.h"
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    // Sin conexiones ni ruido cada instancia reproduce exactamente el motor por objetos
+    TEST(EnsembleSimulatorTest, MatchesNetworkManagerWithoutNoise) {
+        NetworkManager manager;
+        for (int i = 0; i < 4; ++i) {
+            manager.createNeuron(NeuronType::Izhikevich,
+                                 {0.02 + 0.02 * i, 0.2, -65.0, 8.0, 30.0, -65.0, 1.0, 1.0, 2.0});
+        }
+
+        EnsembleConfig config;
+        config.numInstances = 3;
+        EnsembleSimulator ensemble(manager, config);
+
+        manager.advance(300);
+        ensemble.advance(300);
+
+        const auto& expected = manager.getRecentSpikes();
+        for (std::size_t k = 0; k < 3; ++k) {
+            const auto& spikes = ensemble.getSpikes(k);
+            ASSERT_EQ(spikes.size(), expected.size());
+            for (std::size_t s = 0; s < spikes.size(); ++s) {
+                EXPECT_EQ(spikes[s].neuronIndex, expected[s].neuronIndex);
+                EXPECT_EQ(spikes[s].tick, expected[s].tick);
+            }
+            for (std::size_t n = 0; n < 4; ++n) {
+                EXPECT_EQ(ensemble.getPotential(k, n), manager.getNeurons()[n]->getPotential());
+            }
+        }
+    }
+
+    // Cada instancia depende solo de su semilla, no del tamaño del conjunto
+    TEST(EnsembleSimulatorTest, InstancesFollowTheirOwnSeed) {
+        NetworkManager manager;
+        NetworkConfig network;
+        network.totalNeurons = 100;
+        network.excitatoryRatio = 0.8;
+        network.inhibitoryRatio = 0.2;
+        network.connectivityStrategy = "Random";
+        network.excitatoryConnectivity = {0.1, 0.5, true};
+        network.inhibitoryConnectivity = {0.1, 0.5, false};
+        network.seed = 7;
+        manager.createNetwork(network);
+
+        EnsembleConfig config;
+        config.numInstances = 4;
+        config.backgroundCurrent = 3.0;
+        config.noiseStd = 4.0;
+        config.seeds = {11, 12, 13, 14};
+        EnsembleSimulator ensemble(manager, config);
+        std::size_t numSynapses = 0;
+        for (const auto& neuron : manager.getNeurons()) {
+            numSynapses += neuron->getOutgoingSynapses().size();
+        }
+        EXPECT_EQ(ensemble.getNumSynapses(), numSynapses);
+        ensemble.advance(200);
+
+        config.numInstances = 1;
+        config.seeds = {13};
+        EnsembleSimulator single(manager, config);
+        single.advance(200);
+
+        EXPECT_GT(single.getSpikeCount(0), 0u);
+        EXPECT_EQ(ensemble.getSpikeCount(2), single.getSpikeCount(0));
+        EXPECT_EQ(ensemble.getPotential(2, 50), single.getPotential(0, 50));
+        const bool sameAsNeighbour = ensemble.getSpikes(0).size() == ensemble.getSpikes(1).size() &&
+                                     ensemble.getPotential(0, 50) == ensemble.getPotential(1, 50);
+        EXPECT_FALSE(sameAsNeighbour);
+    }
+
+    // En una red conectada cada instancia del conjunto reproduce su ejecución por separado,
+    // y avanzar las K instancias a la vez cuesta menos que K ejecuciones en serie del motor
+    // por objetos (lo que hoy supone repetir la simulación una vez por ensayo)
+    TEST(EnsembleSimulatorTest, ConnectedEnsembleMatchesAndOutpacesSerialRuns) {
+        NetworkConfig network;
+        network.totalNeurons = 400;
+        network.excitatoryRatio = 0.8;
+        network.inhibitoryRatio = 0.2;
+        network.connectivityStrategy = "Random";
+        network.excitatoryConnectivity = {0.05, 1.0, true};
+        network.inhibitoryConnectivity = {0.05, 2.0, false};
+        network.seed = 3;
+        NetworkManager manager;
+        manager.createNetwork(network);
+
+        const std::size_t instances = 16;
+        const long long ticks = 300;
+        const double background = 6.0;
+        EnsembleConfig config;
+        config.numInstances = instances;
+        config.backgroundCurrent = background;
+
+        // Sin ruido, cada instancia se distingue por un estímulo inicial propio
+        auto kickedNeuron = [](std::size_t n, std::size_t k) { return (n * 7 + k * 13) % 400; };
+
+        using Clock = std::chrono::steady_clock;
+        EnsembleSimulator ensemble(manager, config);
+        for (std::size_t k = 0; k < instances; ++k) {
+            for (std::size_t n = 0; n < 40; ++n) {
+                ensemble.injectExternalCurrent(k, kickedNeuron(n, k), 20.0);
+            }
+        }
+        const auto ensembleStart = Clock::now();
+        ensemble.advance(ticks);
+        const auto ensembleTime = Clock::now() - ensembleStart;
+
+        Clock::duration serialTime{0};
+        std::uint64_t totalSpikes = 0;
+        for (std::size_t k = 0; k < instances; ++k) {
+            EnsembleConfig serialConfig = config;
+            serialConfig.numInstances = 1;
+            EnsembleSimulator single(manager, serialConfig);
+            NetworkManager serial;
+            serial.setLogger(nullptr);
+            serial.createNetwork(network);
+            serial.setBackgroundCurrent(background);
+            for (std::size_t n = 0; n < 40; ++n) {
+                single.injectExternalCurrent(0, kickedNeuron(n, k), 20.0);
+                serial.injectExternalCurrent(kickedNeuron(n, k), 20.0);
+            }
+            single.advance(ticks);
+            const auto serialStart = Clock::now();
+            serial.advance(ticks);
+            serialTime += Clock::now() - serialStart;
+
+            const auto& expected = single.getSpikes(0);
+            const auto& actual = ensemble.getSpikes(k);
+            ASSERT_EQ(actual.size(), expected.size());
+            for (std::size_t s = 0; s < actual.size(); ++s) {
+                EXPECT_EQ(actual[s].neuronIndex, expected[s].neuronIndex);
+                EXPECT_EQ(actual[s].tick, expected[s].tick);
+            }
+            totalSpikes += expected.size();
+        }
+
+        // Actividad suficiente para que la entrega por sinapsis pese en el tiempo
+        EXPECT_GT(totalSpikes, instances * 1000);
+        EXPECT_NE(ensemble.getSpikes(0).size(), ensemble.getSpikes(1).size());
+        std::cout << "Conjunto: " << std::chrono::duration<double, std::milli>(ensembleTime).count()
+                  << " ms, serie: " << std::chrono::duration<double, std::milli>(serialTime).count()
+                  << " ms" << std::endl;
+        EXPECT_LT(ensembleTime, serialTime);
+    }
+}
@@ -0,0 +1,125 @@
+// tests/Network/test_multi_rate.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    // Una población con múltiplo 4 sobre un paso base de 0.25 ms sigue la misma
+    // trayectoria que la red integrada con 1 ms, y dispara en el último paso de cada ventana
+    TEST(MultiRateTest, SlowPopulationMatchesCoarseStep) {
+        NetworkManager fine;
+        NetworkManager coarse;
+        fine.setLogger(nullptr);
+        coarse.setLogger(nullptr);
+        fine.createNeuron(NeuronType::Izhikevich);
+        coarse.createNeuron(NeuronType::Izhikevich);
+        fine.setTimeStep(0.25);
+        coarse.setTimeStep(1.0);
+        fine.setPopulationTiming({0}, {PopulationTiming{4, 0.1}});
+        EXPECT_EQ(fine.getStepMultiple(0), 4);
+
+        std::vector<long long> fineTicks;
+        std::vector<long long> coarseTicks;
+        for (long long t = 0; t < 200; ++t) {
+            fine.advance(4 * (t + 1));
+            coarse.advance(t + 1);
+            for (const auto& spike : fine.getRecentSpikes()) fineTicks.push_back(spike.tick);
+            for (const auto& spike : coarse.getRecentSpikes()) coarseTicks.push_back(spike.tick);
+            EXPECT_EQ(fine.getNeurons()[0]->getMembranePotential(), coarse.getNeurons()[0]->getMembranePotential());
+        }
+
+        ASSERT_FALSE(coarseTicks.empty());
+        ASSERT_EQ(fineTicks.size(), coarseTicks.size());
+        for (std::size_t k = 0; k < fineTicks.size(); ++k) {
+            EXPECT_EQ(fineTicks[k], 4 * coarseTicks[k] + 3);
+        }
+    }
+
+    // Cada población solo cuenta las actualizaciones de sus propios pasos
+    TEST(MultiRateTest, UpdatesOnlyOnOwnTicks) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (int i = 0; i < 3; ++i) {
+            manager.createNeuron(NeuronType::Izhikevich);
+        }
+        manager.setPopulationTiming({0, 1, 1}, {PopulationTiming{1, 0.1}, PopulationTiming{4, 0.0}});
+        manager.advance(8);
+        EXPECT_EQ(manager.getStats().neuronUpdates, 8u + 2u * 2u);
+
+        EXPECT_THROW(manager.setPopulationTiming({0, 0}, {PopulationTiming{}}), std::invalid_argument);
+        EXPECT_THROW(manager.setPopulationTiming({0, 0, 2}, {PopulationTiming{}}), std::out_of_range);
+        EXPECT_THROW(manager.setPopulationTiming({0, 0, 0}, {PopulationTiming{0, 0.1}}), std::invalid_argument);
+    }
+
+    // La entrada sináptica se promedia en la ventana: el PSP de un spike no depende de k
+    TEST(MultiRateTest, PostsynapticPotentialIndependentOfStepMultiple) {
+        auto pspAmplitude = [](int multiple) {
+            NetworkManager manager;
+            manager.setLogger(nullptr);
+            manager.setBackgroundCurrent(0.0);
+            manager.setTimeStep(0.25);
+            auto pre = manager.createNeuron(NeuronType::LIF);
+            auto post = manager.createNeuron(NeuronType::LIF);
+            manager.connectExcitatory(pre, post, 5.0, 1.0);
+            manager.setPopulationTiming({0, 1}, {PopulationTiming{1, 0.1}, PopulationTiming{multiple, 0.1}});
+
+            const double rest = post->getMembranePotential();
+            double peak = rest;
+            manager.injectExternalCurrent(0, 3000.0);
+            for (long long tick = 1; tick <= 40; ++tick) {
+                manager.advance(tick);
+                peak = std::max(peak, manager.getNeurons()[1]->getMembranePotential());
+            }
+            EXPECT_EQ(manager.getStats().synapticEvents, 1u);
+            return peak - rest;
+        };
+
+        const double single = pspAmplitude(1);
+        EXPECT_NEAR(single, 0.0125, 1e-4);
+        EXPECT_NEAR(pspAmplitude(4), single, 1e-4);
+        EXPECT_NEAR(pspAmplitude(8), single, 1e-4);
+    }
+
+    // El salto de intervalos inactivos avanza cada población con su propio paso,
+    // y el tiempo de disparo de una población lenta es el de su paso de emisión.
+    // Sin periodo refractario, para que la corriente acumulada durante él no
+    // impida comparar el salto con la integración paso a paso
+    TEST(MultiRateTest, QuiescentSkippingUsesOwnStep) {
+        NetworkManager stepwise;
+        NetworkManager skipping;
+        const std::vector<double> params{-65.0, -65.0, -60.0, 10.0, 100.0, 0.0};
+        for (NetworkManager* manager : {&stepwise, &skipping}) {
+            manager->setLogger(nullptr);
+            manager->setBackgroundCurrent(0.2);
+            manager->setTimeStep(0.25);
+            for (int i = 0; i < 3; ++i) {
+                manager->createNeuron(NeuronType::LIF, params);
+            }
+            manager->setPopulationTiming({0, 1, 2}, {PopulationTiming{1, 0.1}, PopulationTiming{4, 0.1},
+                                                     PopulationTiming{8, 0.1}});
+        }
+        skipping.setQuiescentSkipping(true);
+
+        for (long long pulse = 0; pulse < 4; ++pulse) {
+            for (NetworkManager* manager : {&stepwise, &skipping}) {
+                manager->injectExternalCurrent(1, pulse % 2 == 0 ? 500.0 : 8000.0);
+                manager->advance((pulse + 1) * 400);
+            }
+            const auto& spikes = skipping.getRecentSpikes();
+            for (const auto& spike : spikes) {
+                EXPECT_EQ(skipping.getNeurons()[spike.neuronIndex]->getLastSpikeTime(), spike.tick * 0.25);
+            }
+            for (std::size_t i = 0; i < 3; ++i) {
+                EXPECT_NEAR(skipping.getNeurons()[i]->getMembranePotential(),
+                            stepwise.getNeurons()[i]->getMembranePotential(), 1e-9);
+            }
+        }
+
+        EXPECT_GT(skipping.getStats().skippedSteps, 1000);
+        EXPECT_EQ(skipping.getNeurons()[1]->getLastSpikeTime(), stepwise.getNeurons()[1]->getLastSpikeTime());
+        EXPECT_EQ(std::fmod(stepwise.getNeurons()[1]->getLastSpikeTime() / 0.25 + 1.0, 4.0), 0.0);
+    }
+}
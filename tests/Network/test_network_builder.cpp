@@ -0,0 +1,81 @@
+// tests/Network/test_network_builder.cpp
+#include <gtest/gtest.h>
+#include <random>
+#include <stdexcept>
+#include "Network/NetworkManager.h"
+#include "Network/NetworkBuilder.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        NetworkBuilder randomEdges(std::size_t numNeurons, std::size_t numEdges) {
+            NetworkBuilder builder(numNeurons);
+            std::mt19937 gen(7);
+            std::uniform_int_distribution<std::uint32_t> index(0, static_cast<std::uint32_t>(numNeurons - 1));
+            std::uniform_real_distribution<double> value(1.0, 3.0);
+            for (std::size_t e = 0; e < numEdges; ++e) {
+                builder.addEdge(index(gen), index(gen), value(gen), value(gen), e % 4 != 0);
+            }
+            return builder;
+        }
+
+        void expectSameSynapses(const std::vector<std::shared_ptr<ISynapse>>& a,
+                                const std::vector<std::shared_ptr<ISynapse>>& b)
+        {
+            ASSERT_EQ(a.size(), b.size());
+            for (std::size_t s = 0; s < a.size(); ++s) {
+                EXPECT_EQ(a[s]->getPreNeuron()->getID(), b[s]->getPreNeuron()->getID());
+                EXPECT_EQ(a[s]->getPostNeuron()->getID(), b[s]->getPostNeuron()->getID());
+                EXPECT_EQ(a[s]->getDelay(), b[s]->getDelay());
+            }
+        }
+    }
+
+    // El builder produce las mismas listas, en el mismo orden, que conectar arista a arista
+    TEST(NetworkBuilderTest, MatchesPerEdgeConnections) {
+        const std::size_t numNeurons = 50;
+        const NetworkBuilder builder = randomEdges(numNeurons, 2000);
+
+        NetworkManager perEdge;
+        NetworkManager bulk;
+        ParallelConfig parallel;
+        parallel.numThreads = 4;
+        parallel.pinThreads = false;
+        bulk.setParallelConfig(parallel);
+        for (std::size_t i = 0; i < numNeurons; ++i) {
+            perEdge.createNeuron(NeuronType::LIF);
+            bulk.createNeuron(NeuronType::LIF);
+        }
+
+        const auto &neurons = perEdge.getNeurons();
+        for (std::size_t e = 0; e < builder.size(); ++e) {
+            const auto &pre = neurons[builder.getPre()[e]];
+            const auto &post = neurons[builder.getPost()[e]];
+            if (builder.getExcitatory()[e]) {
+                perEdge.connectExcitatory(pre, post, builder.getWeights()[e], builder.getDelays()[e]);
+            } else {
+                perEdge.connectInhibitory(pre, post, builder.getWeights()[e], builder.getDelays()[e]);
+            }
+        }
+        bulk.addConnections(builder);
+
+        for (std::size_t i = 0; i < numNeurons; ++i) {
+            expectSameSynapses(perEdge.getNeurons()[i]->getOutgoingSynapses(),
+                               bulk.getNeurons()[i]->getOutgoingSynapses());
+            expectSameSynapses(perEdge.getNeurons()[i]->getIncomingSynapses(),
+                               bulk.getNeurons()[i]->getIncomingSynapses());
+        }
+
+        perEdge.advance(200);
+        bulk.advance(200);
+        EXPECT_EQ(bulk.getStats().synapticEvents, perEdge.getStats().synapticEvents);
+    }
+
+    TEST(NetworkBuilderTest, RejectsOutOfRangeEdges) {
+        NetworkManager manager;
+        manager.createNeuron(NeuronType::LIF);
+        NetworkBuilder builder(2);
+        builder.addExcitatory(0, 1);
+        EXPECT_THROW(manager.addConnections(builder), std::out_of_range);
+    }
+
+}
@@ -1,6 +1,8 @@
 // tests/test_network_manager.cpp
 #include <gtest/gtest.h>
+#include <algorithm>
 #include "Network/NetworkManager.h"
+
 namespace BioNeuralNetwork {
     // Verificar que se pueden crear neuronas en el NetworkManager
     TEST(NetworkManagerTest, CreateNeurons) {
@@ -8,4 +10,36 @@ namespace BioNeuralNetwork {
         auto neuron = manager.createNeuron(NeuronType::LIF);
         EXPECT_NE(neuron, nullptr);
     }
-}
\ No newline at end of file
+
+    // Avanzar en varios tramos debe producir los mismos spikes que un único tramo
+    TEST(NetworkManagerTest, AdvanceIsIncremental) {
+        auto build = [](NetworkManager& m) {
+            auto a = m.createNeuron(NeuronType::Izhikevich);
+            auto b = m.createNeuron(NeuronType::Izhikevich);
+            m.connectExcitatory(a, b, 2.0, 2.0);
+            m.connectInhibitory(b, a, 1.0, 1.0);
+        };
+
+        NetworkManager single;
+        build(single);
+        single.advance(200);
+        std::vector<long long> expected;
+        for (const auto& s : single.getRecentSpikes()) {
+            expected.push_back(s.tick * 10 + static_cast<long long>(s.neuronIndex));
+        }
+
+        NetworkManager chunked;
+        build(chunked);
+        std::vector<long long> actual;
+        for (long long t = 0; t < 200; t += 7) {
+            chunked.advance(std::min<long long>(t + 7, 200));
+            for (const auto& s : chunked.getRecentSpikes()) {
+                actual.push_back(s.tick * 10 + static_cast<long long>(s.neuronIndex));
+            }
+        }
+
+        EXPECT_FALSE(expected.empty());
+        EXPECT_EQ(chunked.getCurrentTick(), 200);
+        EXPECT_EQ(actual, expected);
+    }
+}
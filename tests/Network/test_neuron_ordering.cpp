@@ -0,0 +1,66 @@
+// tests/Network/test_neuron_ordering.cpp
+#include <gtest/gtest.h>
+#include <memory>
+#include <set>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    // Un anillo creado con índices desordenados debe quedar compacto tras RCM
+    TEST(NeuronOrderingTest, ReverseCuthillMcKeeReducesIndexDistance) {
+        const std::size_t n = 64;
+        NetworkManager manager;
+        for (std::size_t i = 0; i < n; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        const auto neurons = manager.getNeurons();
+        auto scrambled = [&](std::size_t i) { return neurons[(i * 37) % n]; };
+        for (std::size_t i = 0; i < n; ++i) {
+            manager.connectExcitatory(scrambled(i), scrambled((i + 1) % n));
+        }
+
+        std::set<int> idsBefore;
+        for (const auto& neuron : neurons) {
+            idsBefore.insert(neuron->getID());
+        }
+        const double before = manager.getMeanSynapticIndexDistance();
+
+        manager.reorderNeurons(NeuronOrdering::ReverseCuthillMcKee);
+
+        EXPECT_LT(manager.getMeanSynapticIndexDistance(), before / 4.0);
+
+        std::set<int> idsAfter;
+        std::size_t outgoing = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto& neuron = manager.getNeurons()[i];
+            idsAfter.insert(neuron->getID());
+            outgoing += neuron->getOutgoingSynapses().size();
+            // El mapa de índices conserva la identidad de cada neurona
+            EXPECT_EQ(neuron->getID(), neurons[manager.getOriginalIndex(i)]->getID());
+        }
+        EXPECT_EQ(idsAfter, idsBefore);
+        EXPECT_EQ(outgoing, n);
+    }
+
+    // Tras reordenar, las neuronas y sinapsis anteriores se liberan
+    TEST(NeuronOrderingTest, ReorderReleasesPreviousGraph) {
+        NetworkManager manager;
+        for (int i = 0; i < 16; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        for (std::size_t i = 0; i < 16; ++i) {
+            manager.connectExcitatory(manager.getNeurons()[i], manager.getNeurons()[(i * 5 + 3) % 16]);
+        }
+
+        std::weak_ptr<INeuron> oldNeuron = manager.getNeurons()[0];
+        std::weak_ptr<ISynapse> oldSynapse = manager.getNeurons()[0]->getOutgoingSynapses()[0];
+        manager.reorderNeurons(NeuronOrdering::ReverseCuthillMcKee);
+
+        EXPECT_TRUE(oldNeuron.expired());
+        EXPECT_TRUE(oldSynapse.expired());
+        std::size_t outgoing = 0;
+        for (const auto& neuron : manager.getNeurons()) {
+            outgoing += neuron->getOutgoingSynapses().size();
+        }
+        EXPECT_EQ(outgoing, 16u);
+    }
+}
@@ -0,0 +1,70 @@
+// tests/Network/test_parameter_sweep.cpp
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include "Core/Logger.h"
+#include "Network/ParameterSweep.h"
+
+namespace BioNeuralNetwork {
+    // Las ejecuciones concurrentes no comparten estado: mismo resultado que en serie
+    TEST(ParameterSweepTest, ConcurrentRunsMatchSerialRuns) {
+        NetworkConfig network;
+        network.totalNeurons = 80;
+        network.excitatoryRatio = 0.8;
+        network.inhibitoryRatio = 0.2;
+        network.connectivityStrategy = "Random";
+        network.excitatoryConnectivity = {0.1, 0.5, true};
+        network.inhibitoryConnectivity = {0.1, 0.5, false};
+        network.seed = 3;
+
+        std::vector<SweepAxis> axes = {
+            {SweepParameter::BackgroundCurrent, {4.0, 10.0}},
+            {SweepParameter::IzhikevichD, {2.0, 8.0}},
+        };
+        SweepConfig config;
+        config.tMax = 200.0;
+        config.numThreads = 2;
+
+        const int globalSpikesBefore = Logger::getInstance().getSpikeCount();
+        ParameterSweep sweep(network, axes, config);
+        ASSERT_EQ(sweep.getNumRuns(), 4u);
+        EXPECT_EQ(sweep.getRunValues(1), (std::vector<double>{4.0, 8.0}));
+        const auto concurrent = sweep.run();
+
+        config.numThreads = 1;
+        ParameterSweep serial(network, axes, config);
+        const auto expected = serial.run();
+
+        for (std::size_t r = 0; r < 4; ++r) {
+            EXPECT_EQ(concurrent[r].spikes, expected[r].spikes);
+            EXPECT_EQ(concurrent[r].weightChanges, expected[r].weightChanges);
+            EXPECT_DOUBLE_EQ(concurrent[r].meanExcitatoryWeight, expected[r].meanExcitatoryWeight);
+        }
+        EXPECT_GT(concurrent[2].spikes, concurrent[0].spikes);
+        EXPECT_EQ(Logger::getInstance().getSpikeCount(), globalSpikesBefore);
+
+        const std::string filename = "parameter_sweep_test.csv";
+        sweep.exportCSV(filename);
+        std::ifstream file(filename);
+        std::string line;
+        int lines = 0;
+        while (std::getline(file, line)) {
+            ++lines;
+        }
+        EXPECT_EQ(lines, 5);
+        std::remove(filename.c_str());
+    }
+
+    TEST(ParameterSweepTest, NeuronIdsArePerNetwork) {
+        NetworkManager first;
+        NetworkManager second;
+        first.createNeuron(NeuronType::LIF);
+        first.createNeuron(NeuronType::Izhikevich);
+        second.createNeuron(NeuronType::Izhikevich);
+
+        EXPECT_EQ(first.getNeurons()[0]->getID(), 1);
+        EXPECT_EQ(first.getNeurons()[1]->getID(), 2);
+        EXPECT_EQ(second.getNeurons()[0]->getID(), 1);
+    }
+}
@@ -0,0 +1,74 @@
+// tests/Network/test_procedural_projection.cpp
+#include <gtest/gtest.h>
+#include <vector>
+#include "Network/NetworkManager.h"
+#include "Network/ProceduralProjection.h"
+#include "Synapses/ExcitatorySynapse.h"
+
+namespace BioNeuralNetwork {
+    TEST(ProceduralProjectionTest, TargetsAreDeterministicWithExpectedDensity) {
+        ProceduralProjectionConfig config;
+        config.preEnd = 200;
+        config.postEnd = 1000;
+        config.connectionProbability = 0.05;
+        config.seed = 42;
+        ProceduralProjection projection(config);
+
+        std::size_t total = 0;
+        for (std::size_t pre = 0; pre < 200; ++pre) {
+            std::vector<std::size_t> first;
+            std::vector<std::size_t> second;
+            projection.forEachTarget(pre, [&](std::size_t post, double, double) { first.push_back(post); });
+            projection.forEachTarget(pre, [&](std::size_t post, double, double) { second.push_back(post); });
+            EXPECT_EQ(first, second);
+            total += first.size();
+        }
+        EXPECT_NEAR(static_cast<double>(total), projection.expectedSynapseCount(), 0.1 * projection.expectedSynapseCount());
+    }
+
+    // La proyección procedural entrega lo mismo que sus sinapsis materializadas sin STDP
+    TEST(ProceduralProjectionTest, MatchesMaterializedSynapses) {
+        ProceduralProjectionConfig config;
+        config.preEnd = 40;
+        config.postEnd = 40;
+        config.connectionProbability = 0.2;
+        config.minWeight = 2.0;
+        config.maxWeight = 2.0;
+        config.minDelay = 1.0;
+        config.maxDelay = 3.0;
+        config.seed = 9;
+
+        NetworkManager procedural;
+        NetworkManager materialized;
+        for (int i = 0; i < 40; ++i) {
+            procedural.createNeuron(NeuronType::Izhikevich);
+            materialized.createNeuron(NeuronType::Izhikevich);
+        }
+        procedural.addProceduralProjection(config);
+
+        const auto& neurons = materialized.getNeurons();
+        for (std::size_t pre = 0; pre < 40; ++pre) {
+            procedural.getProceduralProjections()[0].forEachTarget(pre, [&](std::size_t post, double weight, double delay) {
+                materialized.connectExcitatory(neurons[pre], neurons[post], weight, delay);
+                auto synapse = std::dynamic_pointer_cast<ExcitatorySynapse>(neurons[pre]->getOutgoingSynapses().back());
+                synapse->setPotentiationAmplitude(0.0);
+                synapse->setDepressionAmplitude(0.0);
+            });
+        }
+
+        procedural.setBackgroundCurrent(6.0);
+        materialized.setBackgroundCurrent(6.0);
+        procedural.advance(300);
+        materialized.advance(300);
+
+        const auto& expected = materialized.getRecentSpikes();
+        const auto& actual = procedural.getRecentSpikes();
+        ASSERT_GT(expected.size(), 0u);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t s = 0; s < expected.size(); ++s) {
+            EXPECT_EQ(actual[s].neuronIndex, expected[s].neuronIndex);
+            EXPECT_EQ(actual[s].tick, expected[s].tick);
+        }
+        EXPECT_EQ(procedural.getStats().synapticEvents, materialized.getStats().synapticEvents);
+    }
+}
@@ -0,0 +1,89 @@
+// tests/Network/test_quiescent_skipping.cpp
+#include <gtest/gtest.h>
+#include <vector>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        // Pulsos aislados a la neurona 0 cada period pasos; devuelve los spikes emitidos
+        std::vector<EmittedSpike> runPulses(NetworkManager& manager, double pulse, long long period, int pulses) {
+            std::vector<EmittedSpike> spikes;
+            for (int p = 0; p < pulses; ++p) {
+                manager.injectExternalCurrent(0, pulse);
+                manager.advance(manager.getCurrentTick() + period);
+                const auto& recent = manager.getRecentSpikes();
+                spikes.insert(spikes.end(), recent.begin(), recent.end());
+            }
+            return spikes;
+        }
+
+        void buildPair(NetworkManager& manager, NeuronType type, double weight) {
+            auto a = manager.createNeuron(type);
+            auto b = manager.createNeuron(type);
+            manager.connectExcitatory(a, b, weight, 2.0);
+            manager.setBackgroundCurrent(0.0);
+        }
+    }
+
+    // Con estímulos escasos se saltan los intervalos inactivos y los spikes no cambian
+    TEST(QuiescentSkippingTest, LifSparseStimulusMatchesStepping) {
+        NetworkManager stepping;
+        NetworkManager skipping;
+        buildPair(stepping, NeuronType::LIF, 800.0);
+        buildPair(skipping, NeuronType::LIF, 800.0);
+        skipping.setQuiescentSkipping(true);
+
+        const auto expected = runPulses(stepping, 800.0, 200, 5);
+        const auto actual = runPulses(skipping, 800.0, 200, 5);
+
+        ASSERT_GE(expected.size(), 5u);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t s = 0; s < expected.size(); ++s) {
+            EXPECT_EQ(actual[s].neuronIndex, expected[s].neuronIndex);
+            EXPECT_EQ(actual[s].tick, expected[s].tick);
+        }
+        EXPECT_GT(skipping.getStats().skippedSteps, 800);
+        EXPECT_EQ(skipping.getStats().steps, stepping.getStats().steps);
+        EXPECT_NEAR(skipping.getNeurons()[1]->getPotential(), stepping.getNeurons()[1]->getPotential(), 1e-9);
+    }
+
+    TEST(QuiescentSkippingTest, IzhikevichSkipsOnlyAtRest) {
+        NetworkManager stepping;
+        NetworkManager skipping;
+        buildPair(stepping, NeuronType::Izhikevich, 40.0);
+        buildPair(skipping, NeuronType::Izhikevich, 40.0);
+        skipping.setQuiescentSkipping(true);
+
+        const auto expected = runPulses(stepping, 60.0, 2000, 3);
+        const auto actual = runPulses(skipping, 60.0, 2000, 3);
+
+        ASSERT_GT(expected.size(), 0u);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (std::size_t s = 0; s < expected.size(); ++s) {
+            EXPECT_EQ(actual[s].tick, expected[s].tick);
+        }
+        EXPECT_GT(skipping.getStats().skippedSteps, 0);
+        EXPECT_NEAR(skipping.getNeurons()[0]->getPotential(), stepping.getNeurons()[0]->getPotential(), 1e-3);
+    }
+
+    // Con la corriente de fondo por defecto (sobre la reobase) Izhikevich no tiene
+    // reposo: no se salta nada. Bajo la reobase, el salto se aplica tras converger
+    TEST(QuiescentSkippingTest, IzhikevichSkipsOnlyBelowRheobase) {
+        NetworkManager byDefault;
+        auto a = byDefault.createNeuron(NeuronType::Izhikevich);
+        auto b = byDefault.createNeuron(NeuronType::Izhikevich);
+        byDefault.connectExcitatory(a, b, 5.0, 2.0);
+        byDefault.setQuiescentSkipping(true);
+        byDefault.advance(3000);
+        EXPECT_EQ(byDefault.getStats().skippedSteps, 0);
+        EXPECT_EQ(byDefault.getNeurons()[0]->quiescentHorizon(100, 1.0, byDefault.getBackgroundCurrent(), 1e-6), 0);
+
+        NetworkManager subthreshold;
+        subthreshold.createNeuron(NeuronType::Izhikevich);
+        subthreshold.createNeuron(NeuronType::Izhikevich);
+        subthreshold.setBackgroundCurrent(3.0);
+        subthreshold.setQuiescentSkipping(true);
+        subthreshold.advance(3000);
+        EXPECT_GT(subthreshold.getStats().skippedSteps, 0);
+    }
+}
@@ -0,0 +1,126 @@
+// tests/Network/test_simulation_server.cpp
+#include <gtest/gtest.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cstring>
+#include <memory>
+#include <string>
+#include "Network/SimulationServer.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        std::string field(const std::string& response, const std::string& key) {
+            const std::size_t start = response.find(" " + key + "=");
+            if (start == std::string::npos) {
+                return "";
+            }
+            const std::size_t begin = start + key.size() + 2;
+            return response.substr(begin, response.find(' ', begin) - begin);
+        }
+    }
+
+    // El segundo trabajo con la misma configuración reutiliza la red y da el mismo resultado
+    TEST(SimulationServerTest, RepeatedJobsHitTheCache) {
+        ServerConfig config;
+        config.socketPath = "/tmp/bnn_test_server_" + std::to_string(::getpid()) + ".sock";
+        config.numWorkers = 2;
+        config.cacheCapacity = 2;
+        SimulationServer server(config);
+        server.start();
+
+        const std::string job = "neurons=60 seed=3 duration=50 stimulus=0:5:40,1:10:40";
+        const std::string first = SimulationServer::sendRequest(config.socketPath, job);
+        const std::string second = SimulationServer::sendRequest(config.socketPath, job);
+        ASSERT_EQ(first.rfind("ok", 0), 0u) << first;
+        EXPECT_EQ(field(first, "cached"), "0");
+        EXPECT_EQ(field(second, "cached"), "1");
+        EXPECT_EQ(field(first, "spikes"), field(second, "spikes"));
+        EXPECT_EQ(field(first, "synaptic_events"), field(second, "synaptic_events"));
+
+        const std::string bad = SimulationServer::sendRequest(config.socketPath, "neurons=60 colour=red");
+        EXPECT_EQ(bad.rfind("error", 0), 0u);
+
+        EXPECT_EQ(SimulationServer::sendRequest(config.socketPath, "shutdown"), "ok");
+        server.wait();
+        EXPECT_EQ(server.getCompletedJobs(), 2u);
+    }
+
+    // Con capacidad 1 la configuración menos reciente se desaloja
+    TEST(SimulationServerTest, CacheEvictsLeastRecentlyUsed) {
+        NetworkCache cache(1);
+        NetworkConfig a = SimulationServer::parseJob("neurons=20 seed=1").network;
+        NetworkConfig b = SimulationServer::parseJob("neurons=20 seed=2").network;
+        bool hit = false;
+        cache.acquire(a, &hit);
+        EXPECT_FALSE(hit);
+        cache.acquire(a, &hit);
+        EXPECT_TRUE(hit);
+        cache.acquire(b, &hit);
+        EXPECT_FALSE(hit);
+        cache.acquire(a, &hit);
+        EXPECT_FALSE(hit);
+        EXPECT_EQ(cache.size(), 1u);
+
+        // Sin semilla fija cada trabajo tiene su propia topología: no se guarda
+        NetworkConfig unseeded = a;
+        unseeded.seed = -1;
+        cache.acquire(unseeded, &hit);
+        cache.acquire(unseeded, &hit);
+        EXPECT_FALSE(hit);
+    }
+
+    // Un cliente conectado que no envía nada no retiene al único hilo de trabajo
+    TEST(SimulationServerTest, IdleClientIsDisconnected) {
+        ServerConfig config;
+        config.socketPath = "/tmp/bnn_test_idle_" + std::to_string(::getpid()) + ".sock";
+        config.numWorkers = 1;
+        config.idleTimeoutMs = 200;
+        SimulationServer server(config);
+        server.start();
+
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, config.socketPath.c_str(), sizeof(addr.sun_path) - 1);
+        const int idle = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        ASSERT_EQ(::connect(idle, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+
+        // El trabajo llega mientras el hilo atiende la conexión inactiva
+        const std::string response =
+            SimulationServer::sendRequest(config.socketPath, "neurons=20 seed=1 duration=10", 5000);
+        EXPECT_EQ(response.rfind("ok", 0), 0u) << response;
+
+        // La conexión inactiva ya está cerrada por el servidor
+        pollfd pfd{idle, POLLIN, 0};
+        ASSERT_EQ(::poll(&pfd, 1, 0), 1);
+        char byte = 0;
+        EXPECT_EQ(::read(idle, &byte, 1), 0);
+        ::close(idle);
+
+        server.stop();
+        EXPECT_EQ(server.getCompletedJobs(), 1u);
+    }
+
+    // Las copias de cada trabajo y las plantillas desalojadas se liberan por completo
+    TEST(SimulationServerTest, JobAndEvictedNetworksAreReleased) {
+        NetworkCache cache(1);
+        NetworkConfig a = SimulationServer::parseJob("neurons=40 seed=1 exc_probability=0.3").network;
+        NetworkConfig b = SimulationServer::parseJob("neurons=40 seed=2 exc_probability=0.3").network;
+
+        std::weak_ptr<INeuron> jobNeuron;
+        {
+            auto job = cache.acquire(a);
+            ASSERT_FALSE(job->getNeurons()[0]->getOutgoingSynapses().empty());
+            jobNeuron = job->getNeurons()[0];
+            job->advance(20);
+        }
+        EXPECT_TRUE(jobNeuron.expired());
+
+        std::weak_ptr<INeuron> templateNeuron = cache.find(a)->getNeurons()[0];
+        EXPECT_FALSE(templateNeuron.expired());
+        cache.acquire(b);
+        EXPECT_EQ(cache.find(a), nullptr);
+        EXPECT_TRUE(templateNeuron.expired());
+    }
+}
@@ -0,0 +1,182 @@
+// tests/Network/test_structural_plasticity.cpp
+#include <gtest/gtest.h>
+#include <array>
+#include <vector>
+#include "Network/NetworkManager.h"
+#include "Synapses/InhibitorySynapse.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        // Neurona 0 dispara con corriente externa; las demás no disparan nunca
+        void driveHub(NetworkManager& manager, long long steps) {
+            for (long long s = 0; s < steps; ++s) {
+                manager.injectExternalCurrent(0, 800.0);
+                manager.advance(manager.getCurrentTick() + 1);
+            }
+        }
+    }
+
+    // Sin spikes post, la STDP lleva los pesos al mínimo y las sinapsis se podan
+    TEST(StructuralPlasticityTest, PrunesSynapsesAtWeightFloor) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        manager.setBackgroundCurrent(0.0);
+        auto hub = manager.createNeuron(NeuronType::LIF);
+        for (int t = 0; t < 20; ++t) {
+            manager.connectExcitatory(hub, manager.createNeuron(NeuronType::LIF), 0.5, 1.0 + t % 3);
+        }
+        StructuralPlasticityConfig config;
+        config.reviewInterval = 10.0;
+        config.pruneAfter = 20.0;
+        manager.enableStructuralPlasticity(config);
+
+        driveHub(manager, 200);
+
+        EXPECT_EQ(manager.getStats().prunedSynapses, 20u);
+        EXPECT_TRUE(hub->getOutgoingSynapses().empty());
+        for (std::size_t i = 1; i < manager.getNeurons().size(); ++i) {
+            EXPECT_TRUE(manager.getNeurons()[i]->getIncomingSynapses().empty());
+        }
+
+        // Sin sinapsis ya no hay entregas
+        const auto delivered = manager.getStats().synapticEvents;
+        driveHub(manager, 50);
+        EXPECT_EQ(manager.getStats().synapticEvents, delivered);
+    }
+
+    TEST(StructuralPlasticityTest, ActiveNeuronsGrowNewSynapses) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        manager.setBackgroundCurrent(0.0);
+        for (int i = 0; i < 10; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        StructuralPlasticityConfig config;
+        config.reviewInterval = 10.0;
+        config.pruneAfter = 1e9;
+        config.growthProbability = 1.0;
+        config.inhibitoryNeurons.assign(10, false);
+        manager.enableStructuralPlasticity(config);
+
+        driveHub(manager, 100);
+
+        const auto &outgoing = manager.getNeurons()[0]->getOutgoingSynapses();
+        EXPECT_GT(manager.getStats().grownSynapses, 0u);
+        EXPECT_EQ(outgoing.size(), manager.getStats().grownSynapses);
+        EXPECT_LE(outgoing.size(), 9u);
+        for (std::size_t i = 1; i < manager.getNeurons().size(); ++i) {
+            EXPECT_TRUE(manager.getNeurons()[i]->getOutgoingSynapses().empty());
+        }
+    }
+
+    // El signo configurado decide el tipo; sin signo ni sinapsis salientes no se crece
+    TEST(StructuralPlasticityTest, GrowthUsesConfiguredSign) {
+        for (bool configured : {false, true}) {
+            NetworkManager manager;
+            manager.setLogger(nullptr);
+            manager.setBackgroundCurrent(0.0);
+            for (int i = 0; i < 10; ++i) {
+                manager.createNeuron(NeuronType::LIF);
+            }
+            StructuralPlasticityConfig config;
+            config.reviewInterval = 10.0;
+            config.pruneAfter = 1e9;
+            config.growthProbability = 1.0;
+            if (configured) {
+                config.inhibitoryNeurons.assign(10, false);
+                config.inhibitoryNeurons[0] = true;
+            }
+            manager.enableStructuralPlasticity(config);
+
+            driveHub(manager, 100);
+
+            const auto &outgoing = manager.getNeurons()[0]->getOutgoingSynapses();
+            if (!configured) {
+                EXPECT_EQ(manager.getStats().grownSynapses, 0u);
+                continue;
+            }
+            ASSERT_FALSE(outgoing.empty());
+            for (const auto &synapse : outgoing) {
+                EXPECT_NE(dynamic_cast<const InhibitorySynapse*>(synapse.get()), nullptr);
+            }
+        }
+    }
+
+    // Con hilos, poda y crecimiento no recolocan la red ni reconstruyen el índice de
+    // entrega: los punteros siguen siendo válidos y el resultado coincide con el de un
+    // hilo y con el de reconstruir el índice entero tras cada revisión
+    TEST(StructuralPlasticityTest, ThreadedReviewsKeepPlacementAndMatchRebuild) {
+        using Record = std::array<double, 3>;
+        auto run = [](std::size_t threads, bool rebuild, bool &handlesKept) {
+            NetworkManager manager;
+            manager.setLogger(nullptr);
+            manager.setBackgroundCurrent(0.0);
+            ParallelConfig parallel;
+            parallel.numThreads = threads;
+            parallel.pinThreads = false;
+            parallel.fanOutChunkSize = 2;
+            manager.setParallelConfig(parallel);
+            for (int i = 0; i < 30; ++i) {
+                manager.createNeuron(NeuronType::LIF);
+            }
+            for (std::size_t pre = 0; pre < 3; ++pre) {
+                for (std::size_t post = 3; post < 30; ++post) {
+                    manager.connectIfAbsent(pre, post, 0.5, 1.0 + static_cast<double>((pre + post) % 3), pre != 2);
+                }
+            }
+            StructuralPlasticityConfig config;
+            config.reviewInterval = 10.0;
+            config.pruneAfter = 20.0;
+            config.growthProbability = 1.0;
+            config.growthWeight = 4.0;
+            config.growthDelay = 4.0;
+            config.inhibitoryNeurons.assign(30, false);
+            config.inhibitoryNeurons[2] = true;
+            manager.enableStructuralPlasticity(config);
+
+            manager.advance(1);
+            const std::vector<std::shared_ptr<INeuron>> handles = manager.getNeurons();
+            std::vector<Record> records;
+            for (long long s = 1; s < 300; ++s) {
+                for (std::size_t hub = 0; hub < 3; ++hub) {
+                    manager.injectExternalCurrent(hub, 800.0);
+                }
+                manager.advance(s + 1);
+                for (const auto &spike : manager.getRecentSpikes()) {
+                    records.push_back({0.0, static_cast<double>(spike.tick), static_cast<double>(spike.neuronIndex)});
+                }
+                if (rebuild && s % 25 == 0) {
+                    // Un cambio de paso ida y vuelta obliga a reconstruir el índice
+                    manager.setTimeStep(0.5);
+                    manager.setTimeStep(1.0);
+                }
+            }
+            // Sin estímulo la cola se vacía: una recolocación pendiente se haría aquí
+            manager.advance(manager.getCurrentTick() + 20);
+            manager.advance(manager.getCurrentTick() + 1);
+            handlesKept = handles == manager.getNeurons();
+            for (std::size_t pre = 0; pre < 30; ++pre) {
+                for (std::size_t post = 0; post < 30; ++post) {
+                    if (manager.isConnected(pre, post)) {
+                        records.push_back({1.0, static_cast<double>(pre * 30 + post),
+                                           manager.getSynapseWeight(pre, post)});
+                    }
+                }
+            }
+            records.push_back({2.0, static_cast<double>(manager.getStats().prunedSynapses),
+                               static_cast<double>(manager.getStats().grownSynapses)});
+            return records;
+        };
+
+        bool kept = false;
+        const auto incremental = run(1, false, kept);
+        const auto rebuilt = run(1, true, kept);
+        const auto threaded = run(4, false, kept);
+        EXPECT_TRUE(kept);
+        EXPECT_GT(incremental.back()[1], 0.0);
+        EXPECT_GT(incremental.back()[2], 0.0);
+        EXPECT_EQ(incremental, rebuilt);
+        EXPECT_EQ(incremental, threaded);
+    }
+
+}
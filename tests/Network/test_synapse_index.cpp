@@ -0,0 +1,87 @@
+// tests/Network/test_synapse_index.cpp
+#include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <utility>
+#include "Network/NetworkManager.h"
+#include "ConnectivityStrategies/SmallWorldConnectivityStrategy.h"
+
+namespace BioNeuralNetwork {
+
+    // Inserciones y borrados aleatorios coinciden con un std::map de referencia
+    TEST(SynapseIndexTest, PairIndexMatchesReferenceMap) {
+        PairIndex<int> index;
+        std::map<std::pair<std::uint32_t, std::uint32_t>, int> reference;
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<std::uint32_t> neuron(0, 40);
+        for (int k = 0; k < 5000; ++k) {
+            const std::uint32_t pre = neuron(rng);
+            const std::uint32_t post = neuron(rng);
+            if (k % 3 == 0) {
+                EXPECT_EQ(index.erase(pre, post), reference.erase({pre, post}) > 0);
+            } else {
+                EXPECT_EQ(index.insert(pre, post, k), reference.emplace(std::make_pair(pre, post), k).second);
+            }
+        }
+        EXPECT_EQ(index.size(), reference.size());
+        for (std::uint32_t pre = 0; pre <= 40; ++pre) {
+            for (std::uint32_t post = 0; post <= 40; ++post) {
+                auto expected = reference.find({pre, post});
+                const int* found = index.find(pre, post);
+                ASSERT_EQ(found != nullptr, expected != reference.end());
+                if (found) {
+                    EXPECT_EQ(*found, expected->second);
+                }
+            }
+        }
+    }
+
+    // Consultas, pesos y connectIfAbsent con el índice activo, también tras reordenar
+    TEST(SynapseIndexTest, ManagerQueriesByPair) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (int i = 0; i < 4; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        manager.connectExcitatory(manager.getNeurons()[0], manager.getNeurons()[1], 2.0);
+        manager.enableSynapseIndex();
+
+        EXPECT_TRUE(manager.isConnected(0, 1));
+        EXPECT_FALSE(manager.isConnected(1, 0));
+        EXPECT_FALSE(manager.connectIfAbsent(0, 1));
+        EXPECT_TRUE(manager.connectIfAbsent(2, 3, 1.5, 1.0, false));
+        EXPECT_FALSE(manager.connectIfAbsent(2, 3));
+
+        manager.setSynapseWeight(2, 3, 3.0);
+        EXPECT_DOUBLE_EQ(manager.getSynapseWeight(2, 3), 3.0);
+        manager.setSynapseWeight(0, 1, 100.0);   // Limitado al máximo de la sinapsis
+        EXPECT_DOUBLE_EQ(manager.getSynapseWeight(0, 1), 10.0);
+        EXPECT_THROW(manager.getSynapseWeight(3, 2), std::out_of_range);
+
+        manager.reorderNeurons(NeuronOrdering::ReverseCuthillMcKee);
+        std::size_t newIndex[4];
+        for (std::size_t k = 0; k < 4; ++k) {
+            newIndex[manager.getOriginalIndex(k)] = k;
+        }
+        EXPECT_DOUBLE_EQ(manager.getSynapseWeight(newIndex[2], newIndex[3]), 3.0);
+        EXPECT_FALSE(manager.isConnected(newIndex[1], newIndex[0]));
+    }
+
+    // Los atajos de mundo pequeño ya no duplican sinapsis existentes
+    TEST(SynapseIndexTest, SmallWorldCreatesNoDuplicates) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (int i = 0; i < 12; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        manager.setConnectivityStrategy(std::make_unique<SmallWorldConnectivityStrategy>(1.0, 6, 3u));
+        manager.applyConnectivityStrategy();
+
+        for (const auto& neuron : manager.getNeurons()) {
+            std::map<const INeuron*, int> targets;
+            for (const auto& synapse : neuron->getOutgoingSynapses()) {
+                EXPECT_EQ(++targets[synapse->getPostNeuron().get()], 1);
+            }
+        }
+    }
+}
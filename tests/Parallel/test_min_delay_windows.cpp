@@ -0,0 +1,119 @@
+// tests/Parallel/test_min_delay_windows.cpp
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "Network/NetworkManager.h"
+
+namespace BioNeuralNetwork {
+
+    namespace {
+
+        void buildRecurrentNetwork(NetworkManager& manager) {
+            std::mt19937 rng(7);
+            std::uniform_int_distribution<std::size_t> pick(0, 199);
+            std::uniform_real_distribution<double> delay(3.0, 6.0);
+            for (int i = 0; i < 200; ++i) {
+                manager.createNeuron(NeuronType::Izhikevich);
+            }
+            const auto& neurons = manager.getNeurons();
+            for (std::size_t pre = 0; pre < neurons.size(); ++pre) {
+                for (int k = 0; k < 10; ++k) {
+                    if (pre % 5 == 0) {
+                        manager.connectInhibitory(neurons[pre], neurons[pick(rng)], 2.0, delay(rng));
+                    } else {
+                        manager.connectExcitatory(neurons[pre], neurons[pick(rng)], 1.5, delay(rng));
+                    }
+                }
+            }
+        }
+
+        std::vector<double> weightsOf(const NetworkManager& manager) {
+            std::vector<double> weights;
+            for (const auto& neuron : manager.getNeurons()) {
+                for (const auto& synapse : neuron->getOutgoingSynapses()) {
+                    weights.push_back(synapse->getWeight());
+                }
+            }
+            return weights;
+        }
+
+        ParallelConfig windowedConfig(std::size_t threads) {
+            ParallelConfig config;
+            config.numThreads = threads;
+            config.pinThreads = false;
+            config.numaFirstTouch = false;
+            config.minDelayWindows = true;
+            return config;
+        }
+
+    }
+
+    // Con ventanas de retardo mínimo el resultado no depende del número de hilos,
+    // y los hilos se sincronizan una vez por ventana
+    TEST(MinDelayWindowTest, IndependentOfThreadCount) {
+        NetworkManager single;
+        NetworkManager threaded;
+        single.setLogger(nullptr);
+        threaded.setLogger(nullptr);
+        buildRecurrentNetwork(single);
+        buildRecurrentNetwork(threaded);
+        single.setParallelConfig(windowedConfig(1));
+        threaded.setParallelConfig(windowedConfig(4));
+
+        std::vector<long long> singleSpikes;
+        std::vector<long long> threadedSpikes;
+        for (long long chunk = 1; chunk <= 10; ++chunk) {
+            single.advance(chunk * 25);
+            threaded.advance(chunk * 25);
+            for (const auto& spike : single.getRecentSpikes()) {
+                singleSpikes.push_back(spike.tick * 1000 + static_cast<long long>(spike.neuronIndex));
+            }
+            for (const auto& spike : threaded.getRecentSpikes()) {
+                threadedSpikes.push_back(spike.tick * 1000 + static_cast<long long>(spike.neuronIndex));
+            }
+        }
+
+        EXPECT_EQ(threaded.getExchangeWindowSteps(), 3);
+        EXPECT_FALSE(threadedSpikes.empty());
+        EXPECT_EQ(singleSpikes, threadedSpikes);
+        EXPECT_EQ(weightsOf(single), weightsOf(threaded));
+        EXPECT_EQ(single.getStats().synapticEvents, threaded.getStats().synapticEvents);
+        // 25 pasos por llamada: 8 ventanas completas y una de un paso
+        EXPECT_EQ(threaded.getStats().threadSynchronizations, 10u * 9u);
+        EXPECT_EQ(single.getStats().threadSynchronizations, 0u);
+    }
+
+    // Si ninguna sinapsis recibe dos spikes en la misma ventana, las ventanas
+    // reproducen exactamente la ejecución paso a paso, STDP incluido
+    TEST(MinDelayWindowTest, MatchesStepwiseWhenWeightsSettleBetweenDeliveries) {
+        NetworkManager stepwise;
+        NetworkManager windowed;
+        for (NetworkManager* manager : {&stepwise, &windowed}) {
+            manager->setLogger(nullptr);
+            manager->setBackgroundCurrent(0.0);
+            auto hub = manager->createNeuron(NeuronType::LIF);
+            for (int t = 0; t < 64; ++t) {
+                auto target = manager->createNeuron(NeuronType::LIF);
+                manager->connectExcitatory(hub, target, 0.5, t % 2 == 0 ? 4.0 : 5.0);
+            }
+        }
+        windowed.setParallelConfig(windowedConfig(4));
+
+        for (long long pulse = 0; pulse < 5; ++pulse) {
+            stepwise.injectExternalCurrent(0, 800.0);
+            windowed.injectExternalCurrent(0, 800.0);
+            stepwise.advance((pulse + 1) * 12);
+            windowed.advance((pulse + 1) * 12);
+        }
+
+        ASSERT_EQ(windowed.getExchangeWindowSteps(), 4);
+        EXPECT_EQ(stepwise.getStats().synapticEvents, 5u * 64u);
+        EXPECT_EQ(windowed.getStats().synapticEvents, stepwise.getStats().synapticEvents);
+        EXPECT_EQ(weightsOf(windowed), weightsOf(stepwise));
+        for (std::size_t i = 0; i < stepwise.getNeurons().size(); ++i) {
+            EXPECT_EQ(windowed.getNeurons()[i]->getMembranePotential(),
+                      stepwise.getNeurons()[i]->getMembranePotential());
+        }
+    }
+
+}
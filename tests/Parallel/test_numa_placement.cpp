@@ -0,0 +1,157 @@
+// tests/Parallel/test_numa_placement.cpp
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <sstream>
+#include "Network/NetworkManager.h"
+#include "Parallel/NumaTopology.h"
+#include "Parallel/PlacementArena.h"
+
+namespace BioNeuralNetwork {
+    namespace {
+        std::vector<std::pair<long long, std::size_t>> runNetwork(const ParallelConfig* parallel) {
+            NetworkConfig config;
+            config.totalNeurons = 60;
+            config.excitatoryRatio = 0.8;
+            config.inhibitoryRatio = 0.2;
+            config.connectivityStrategy = "Random";
+            config.excitatoryConnectivity = {0.1, 3.0, true};
+            config.inhibitoryConnectivity = {0.1, 2.0, false};
+            config.seed = 7;
+
+            NetworkManager manager;
+            manager.createNetwork(config);
+            if (parallel) {
+                manager.setParallelConfig(*parallel);
+            }
+            manager.advance(150);
+
+            std::vector<std::pair<long long, std::size_t>> spikes;
+            for (const auto& s : manager.getRecentSpikes()) {
+                spikes.emplace_back(s.tick, s.neuronIndex);
+            }
+            return spikes;
+        }
+    }
+
+    TEST(NumaTopologyTest, DetectsAtLeastOneNode) {
+        auto topology = NumaTopology::detect();
+        EXPECT_GE(topology.getNumNodes(), 1u);
+        ASSERT_FALSE(topology.getCpus().empty());
+        EXPECT_GE(topology.getNodeOfCpu(topology.getCpus().front()), 0);
+    }
+
+    // La ejecución con particiones colocadas por hilo reproduce la secuencial
+    TEST(NumaPlacementTest, ThreadedRunMatchesSequential) {
+        ParallelConfig parallel;
+        parallel.numThreads = 3;
+        parallel.transparentHugePages = true;
+
+        auto sequential = runNetwork(nullptr);
+        auto threaded = runNetwork(&parallel);
+        EXPECT_FALSE(sequential.empty());
+        EXPECT_EQ(threaded, sequential);
+    }
+
+    TEST(NumaPlacementTest, ReportCoversAllNeurons) {
+        NetworkManager manager;
+        for (int i = 0; i < 10; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        manager.connectExcitatory(manager.getNeurons()[0], manager.getNeurons()[9]);
+
+        ParallelConfig parallel;
+        parallel.numThreads = 2;
+        manager.setParallelConfig(parallel);
+        manager.advance(1);
+
+        const auto& report = manager.getPlacementReport();
+        ASSERT_EQ(report.size(), 2u);
+        EXPECT_EQ(report[0].firstNeuron, 0u);
+        EXPECT_EQ(report[1].endNeuron, 10u);
+        EXPECT_EQ(report[0].synapses + report[1].synapses, 1u);
+        EXPECT_EQ(manager.getNeurons()[0]->getOutgoingSynapses().size(), 1u);
+
+        std::ostringstream out;
+        manager.printPlacementReport(out);
+        EXPECT_NE(out.str().find("Hilo 1"), std::string::npos);
+    }
+
+    // Los objetos de la arena quedan contiguos y la mantienen viva
+    TEST(PlacementArenaTest, AllocatesContiguouslyAndOutlivesOwner) {
+        auto arena = std::make_shared<PlacementArena>(true);
+        std::vector<std::shared_ptr<double>> values;
+        for (int i = 0; i < 1000; ++i) {
+            values.push_back(std::allocate_shared<double>(ArenaAllocator<double>(arena), i));
+        }
+        EXPECT_EQ(arena->getReservedBytes(), 2u * 1024u * 1024u);
+        const auto first = reinterpret_cast<std::uintptr_t>(values.front().get());
+        const auto last = reinterpret_cast<std::uintptr_t>(values.back().get());
+        EXPECT_LT(last - first, 1000u * 64u);
+
+        std::weak_ptr<PlacementArena> watch = arena;
+        arena.reset();
+        EXPECT_FALSE(watch.expired());
+        EXPECT_EQ(*values[999], 999.0);
+        values.clear();
+        EXPECT_TRUE(watch.expired());
+    }
+
+    // Los cambios de conectividad no recolocan la red; relocateMemory sí
+    TEST(NumaPlacementTest, RelocatesOnlyOnExplicitRequest) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (int i = 0; i < 10; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        ParallelConfig parallel;
+        parallel.numThreads = 2;
+        parallel.pinThreads = false;
+        manager.setParallelConfig(parallel);
+        manager.advance(1);
+        const double firstPlacement = manager.getStats().placementSeconds;
+        EXPECT_GT(firstPlacement, 0.0);
+
+        const auto placed = manager.getNeurons();
+        manager.connectExcitatory(placed[0], placed[9]);
+        manager.createNeuron(NeuronType::LIF);
+        manager.advance(2);
+        EXPECT_EQ(manager.getStats().placementSeconds, firstPlacement);
+        for (std::size_t i = 0; i < placed.size(); ++i) {
+            EXPECT_EQ(manager.getNeurons()[i], placed[i]);
+        }
+
+        manager.relocateMemory();
+        manager.advance(3);
+        EXPECT_GT(manager.getStats().placementSeconds, firstPlacement);
+        EXPECT_NE(manager.getNeurons()[0], placed[0]);
+        EXPECT_EQ(manager.getNeurons()[0]->getOutgoingSynapses().size(), 1u);
+        EXPECT_EQ(manager.getPlacementReport().back().endNeuron, 11u);
+    }
+
+    // Al recolocar, la red anterior (neuronas, sinapsis y sus arenas) se libera
+    TEST(NumaPlacementTest, RelocationReleasesPreviousGraph) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        for (int i = 0; i < 10; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        const auto& neurons = manager.getNeurons();
+        for (std::size_t i = 0; i + 1 < neurons.size(); ++i) {
+            manager.connectExcitatory(neurons[i], neurons[i + 1]);
+        }
+        ParallelConfig parallel;
+        parallel.numThreads = 2;
+        parallel.pinThreads = false;
+        manager.setParallelConfig(parallel);
+        manager.advance(1);
+
+        std::weak_ptr<INeuron> oldNeuron = manager.getNeurons()[0];
+        std::weak_ptr<ISynapse> oldSynapse = manager.getNeurons()[0]->getOutgoingSynapses()[0];
+        manager.relocateMemory();
+        manager.advance(2);
+
+        EXPECT_TRUE(oldNeuron.expired());
+        EXPECT_TRUE(oldSynapse.expired());
+        EXPECT_EQ(manager.getNeurons()[0]->getOutgoingSynapses().size(), 1u);
+    }
+}
@@ -0,0 +1,117 @@
+// tests/Parallel/test_work_stealing.cpp
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include "Network/NetworkManager.h"
+#include "Parallel/WorkStealingScheduler.h"
+
+namespace BioNeuralNetwork {
+    // Cada trozo se ejecuta exactamente una vez aunque el reparto esté desequilibrado
+    TEST(WorkStealingSchedulerTest, RunsEveryChunkOnce) {
+        SimulationThreadPool pool(3, false, NumaTopology::detect());
+        WorkStealingScheduler scheduler(pool);
+
+        std::vector<std::atomic<int>> hits(200);
+        scheduler.parallelFor(hits.size(), [&](std::size_t, std::size_t chunk) {
+            hits[chunk].fetch_add(1);
+        });
+        for (const auto& h : hits) {
+            EXPECT_EQ(h.load(), 1);
+        }
+    }
+
+    // Los trozos lentos del primer hilo acaban en los hilos que vacían antes su cola
+    TEST(WorkStealingSchedulerTest, StealsFromImbalancedWorker) {
+        SimulationThreadPool pool(3, false, NumaTopology::detect());
+        WorkStealingScheduler scheduler(pool);
+
+        // Los trozos 0-9 son del hilo 0 y tardan; los demás son inmediatos
+        std::vector<std::atomic<int>> hits(30);
+        std::vector<std::size_t> owner(30);
+        scheduler.parallelFor(hits.size(), [&](std::size_t worker, std::size_t chunk) {
+            if (chunk < 10) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+            owner[chunk] = worker;
+            hits[chunk].fetch_add(1);
+        });
+
+        EXPECT_GT(scheduler.getStolenCount(), 0u);
+        std::size_t slowStolen = 0;
+        for (std::size_t c = 0; c < hits.size(); ++c) {
+            EXPECT_EQ(hits[c].load(), 1);
+            slowStolen += c < 10 && owner[c] != 0 ? 1 : 0;
+        }
+        EXPECT_GT(slowStolen, 0u);
+    }
+
+    // Un hub con miles de sinapsis se propaga en trozos y da el mismo resultado que en serie
+    TEST(WorkStealingSchedulerTest, HubFanOutMatchesSequential) {
+        auto run = [](std::size_t threads) {
+            NetworkManager manager;
+            for (int i = 0; i < 600; ++i) {
+                manager.createNeuron(NeuronType::Izhikevich);
+            }
+            const auto& neurons = manager.getNeurons();
+            for (std::size_t j = 1; j < neurons.size(); ++j) {
+                manager.connectExcitatory(neurons[0], neurons[j], 0.5, 1.0 + (j % 3));
+                manager.connectExcitatory(neurons[j], neurons[0], 0.2);
+            }
+            if (threads > 1) {
+                ParallelConfig parallel;
+                parallel.numThreads = threads;
+                parallel.pinThreads = false;
+                parallel.fanOutChunkSize = 64;
+                manager.setParallelConfig(parallel);
+            }
+            manager.advance(100);
+
+            std::vector<double> state;
+            for (const auto& neuron : manager.getNeurons()) {
+                state.push_back(neuron->getPotential());
+            }
+            return state;
+        };
+
+        EXPECT_EQ(run(3), run(1));
+    }
+
+    // El spike de un único hub se corta en trozos de fanOutChunkSize que ejecutan varios hilos
+    TEST(WorkStealingSchedulerTest, SingleHubFanOutSpreadsAcrossWorkers) {
+        NetworkManager manager;
+        manager.setLogger(nullptr);
+        manager.setBackgroundCurrent(0.0);
+        for (int i = 0; i < 2001; ++i) {
+            manager.createNeuron(NeuronType::LIF);
+        }
+        const auto& neurons = manager.getNeurons();
+        for (std::size_t j = 1; j < neurons.size(); ++j) {
+            manager.connectExcitatory(neurons[0], neurons[j], 0.1);
+        }
+        ParallelConfig parallel;
+        parallel.numThreads = 3;
+        parallel.pinThreads = false;
+        parallel.fanOutChunkSize = 64;
+        manager.setParallelConfig(parallel);
+
+        // Solo dispara el hub
+        for (long long tick = 0; tick < 60; ++tick) {
+            manager.injectExternalCurrent(0, 1000.0);
+            manager.advance(tick + 1);
+        }
+
+        const auto& chunks = manager.getStats().deliveryChunksByWorker;
+        ASSERT_EQ(chunks.size(), 3u);
+        std::size_t busyWorkers = 0;
+        std::uint64_t total = 0;
+        for (std::uint64_t count : chunks) {
+            busyWorkers += count > 0 ? 1 : 0;
+            total += count;
+        }
+        // Cada spike del hub (2000 sinapsis) da al menos 2000 / 64 trozos
+        EXPECT_GE(total, 2000u / 64u);
+        EXPECT_GT(busyWorkers, 1u);
+    }
+}